@@ -0,0 +1,1016 @@
+#ifndef S21_CONTAINERS_SRC_S21_ART_MAP_H_
+#define S21_CONTAINERS_SRC_S21_ART_MAP_H_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+// How art_map turns a key into the bytes it branches on. Keys are ordered
+// by their bytes compared as unsigned values, a proper prefix first, so the
+// encoding has to preserve the order wanted for the keys. Specialize it to
+// use other key types.
+template <typename Key, typename = void>
+struct ArtKeyTraits;
+
+// Big-endian, with the sign bit flipped for signed types, so that byte
+// order is numeric order.
+template <typename Key>
+struct ArtKeyTraits<Key, std::enable_if_t<std::is_integral_v<Key> &&
+                                          !std::is_same_v<Key, bool>>> {
+  using bytes_type = std::array<uint8_t, sizeof(Key)>;
+
+  static bytes_type Encode(Key key) {
+    using Bits = std::make_unsigned_t<Key>;
+    Bits bits = static_cast<Bits>(key);
+    if constexpr (std::is_signed_v<Key>) {
+      bits ^= Bits(Bits(1) << (8 * sizeof(Key) - 1));
+    }
+    bytes_type bytes;
+    for (size_t i = 0; i < sizeof(Key); ++i) {
+      bytes[i] = static_cast<uint8_t>(bits >> (8 * (sizeof(Key) - 1 - i)));
+    }
+    return bytes;
+  }
+};
+
+// The characters themselves, which gives std::string's own order.
+template <>
+struct ArtKeyTraits<std::string> {
+  using bytes_type = std::string_view;
+
+  static bytes_type Encode(const std::string &key) { return key; }
+};
+
+namespace detail {
+
+template <typename T>
+struct IsStdArray : std::false_type {};
+
+template <typename T, size_t N>
+struct IsStdArray<std::array<T, N>> : std::true_type {};
+
+}  // namespace detail
+
+// Sorted map over an adaptive radix tree (Leis et al., "The Adaptive Radix
+// Tree"). Lookups branch on one key byte per level instead of comparing
+// whole keys, so their cost depends on the key length rather than on the
+// number of entries, and dense integer keys share almost every node.
+// Inner nodes come in four sizes (4, 16, 48 and 256 children) and are
+// swapped for the next size up or down as children come and go; Node16 is
+// searched with SSE2 where available. Runs of single-child nodes are
+// collapsed into a prefix stored in the node below.
+//
+// Leaves are also threaded into a sorted list, so iteration never touches
+// the inner nodes and iterators are bidirectional. prefix_range() gives the
+// entries whose key starts with the bytes of another key, e.g. every string
+// beginning with "/api/". Iterators stay valid until their entry is erased.
+template <typename Key, typename T, typename Traits = ArtKeyTraits<Key>>
+class art_map {
+  struct Leaf;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+
+  template <bool IsConst>
+  class ArtMapIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = art_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer =
+        std::conditional_t<IsConst, const value_type *, value_type *>;
+    using reference =
+        std::conditional_t<IsConst, const value_type &, value_type &>;
+
+    ArtMapIterator() = default;
+
+    template <bool C = IsConst, typename = std::enable_if_t<C>>
+    ArtMapIterator(const ArtMapIterator<false> &other)
+        : leaf_(other.leaf_), map_(other.map_) {}
+
+    reference operator*() const { return leaf_->data; }
+    pointer operator->() const { return &leaf_->data; }
+
+    ArtMapIterator &operator++() {
+      leaf_ = leaf_->next;
+      return *this;
+    }
+
+    ArtMapIterator operator++(int) {
+      ArtMapIterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    // --end() is the last entry.
+    ArtMapIterator &operator--() {
+      leaf_ = leaf_ ? leaf_->prev : map_->tail_;
+      return *this;
+    }
+
+    ArtMapIterator operator--(int) {
+      ArtMapIterator old = *this;
+      --*this;
+      return old;
+    }
+
+    bool operator==(const ArtMapIterator &other) const {
+      return leaf_ == other.leaf_;
+    }
+    bool operator!=(const ArtMapIterator &other) const {
+      return leaf_ != other.leaf_;
+    }
+
+   private:
+    ArtMapIterator(Leaf *leaf, const art_map *map) : leaf_(leaf), map_(map) {}
+
+    Leaf *leaf_ = nullptr;
+    const art_map *map_ = nullptr;
+    friend class art_map;
+    friend class ArtMapIterator<!IsConst>;
+  };
+
+  using iterator = ArtMapIterator<false>;
+  using const_iterator = ArtMapIterator<true>;
+
+  art_map() = default;
+
+  art_map(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) insert(item);
+  }
+
+  art_map(const art_map &other) {
+    for (const Leaf *leaf = other.head_; leaf; leaf = leaf->next) {
+      insert(leaf->data);
+    }
+  }
+
+  art_map(art_map &&other) noexcept { swap(other); }
+
+  art_map &operator=(const art_map &other) {
+    art_map copy(other);
+    swap(copy);
+    return *this;
+  }
+
+  art_map &operator=(art_map &&other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  ~art_map() { clear(); }
+
+  iterator begin() noexcept { return iterator(head_, this); }
+  iterator end() noexcept { return iterator(nullptr, this); }
+  const_iterator begin() const noexcept { return const_iterator(head_, this); }
+  const_iterator end() const noexcept {
+    return const_iterator(nullptr, this);
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(Leaf);
+  }
+
+  void clear() noexcept {
+    Free(root_);
+    root_ = nullptr;
+    head_ = tail_ = nullptr;
+    size_ = 0;
+  }
+
+  void swap(art_map &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(size_, other.size_);
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return insert(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    std::pair<Leaf *, bool> result = Insert(key, obj);
+    return {iterator(result.first, this), result.second};
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+    std::pair<Leaf *, bool> result = Insert(key, obj);
+    if (!result.second) result.first->data.second = obj;
+    return {iterator(result.first, this), result.second};
+  }
+
+  mapped_type &operator[](const key_type &key) {
+    return Insert(key, mapped_type()).first->data.second;
+  }
+
+  mapped_type &at(const key_type &key) {
+    Leaf *leaf = FindLeaf(Traits::Encode(key));
+    if (!leaf) throw std::out_of_range("Key not found");
+    return leaf->data.second;
+  }
+
+  const mapped_type &at(const key_type &key) const {
+    return const_cast<art_map *>(this)->at(key);
+  }
+
+  iterator find(const key_type &key) {
+    return iterator(FindLeaf(Traits::Encode(key)), this);
+  }
+  const_iterator find(const key_type &key) const {
+    return const_iterator(FindLeaf(Traits::Encode(key)), this);
+  }
+
+  bool contains(const key_type &key) const {
+    return FindLeaf(Traits::Encode(key)) != nullptr;
+  }
+  size_type count(const key_type &key) const { return contains(key); }
+
+  // First entry not ordered before key.
+  iterator lower_bound(const key_type &key) {
+    return iterator(LowerBound(Traits::Encode(key)), this);
+  }
+  const_iterator lower_bound(const key_type &key) const {
+    return const_iterator(LowerBound(Traits::Encode(key)), this);
+  }
+
+  // The entries whose key bytes begin with those of prefix, in order.
+  std::pair<iterator, iterator> prefix_range(const key_type &prefix) {
+    std::pair<Leaf *, Leaf *> range = PrefixRange(Traits::Encode(prefix));
+    return {iterator(range.first, this), iterator(range.second, this)};
+  }
+  std::pair<const_iterator, const_iterator> prefix_range(
+      const key_type &prefix) const {
+    std::pair<Leaf *, Leaf *> range = PrefixRange(Traits::Encode(prefix));
+    return {const_iterator(range.first, this),
+            const_iterator(range.second, this)};
+  }
+
+  // Returns the entry after pos.
+  iterator erase(const_iterator pos) {
+    Leaf *next = pos.leaf_->next;
+    Erase(Traits::Encode(pos.leaf_->data.first));
+    return iterator(next, this);
+  }
+
+  size_type erase(const key_type &key) { return Erase(Traits::Encode(key)); }
+
+ private:
+  using bytes_type = typename Traits::bytes_type;
+
+  enum NodeType : uint8_t { kLeaf, kNode4, kNode16, kNode48, kNode256 };
+
+  // Prefix bytes past this many are not stored; the few places that need
+  // them read them from a leaf below, which has the same ones.
+  static constexpr uint32_t kMaxPrefix = 8;
+
+  // Keys encoded to a fixed number of bytes, like the integers, can't be
+  // proper prefixes of one another.
+  static constexpr bool kFixedWidth = detail::IsStdArray<bytes_type>::value;
+
+  struct Node {
+    explicit Node(NodeType t) : type(t) {}
+    NodeType type;
+  };
+
+  struct Leaf : Node {
+    Leaf(const key_type &key, const mapped_type &obj)
+        : Node(kLeaf), data(key, obj) {}
+
+    value_type data;
+    Leaf *prev = nullptr;
+    Leaf *next = nullptr;
+  };
+
+  struct Inner : Node {
+    using Node::Node;
+
+    uint16_t count = 0;
+    uint32_t prefix_len = 0;
+    uint8_t prefix[kMaxPrefix] = {};
+    // The key that ends at this node, i.e. is a proper prefix of all the
+    // others below it; sorted before the children.
+    Leaf *terminal = nullptr;
+  };
+
+  // Node4 and Node16 keep their keys sorted.
+  struct Node4 : Inner {
+    Node4() : Inner(kNode4) {}
+    uint8_t keys[4] = {};
+    Node *children[4];
+  };
+
+  struct Node16 : Inner {
+    Node16() : Inner(kNode16) {}
+    uint8_t keys[16] = {};
+    Node *children[16];
+  };
+
+  // index[byte] is one past the child's slot, or 0 when byte has none.
+  struct Node48 : Inner {
+    Node48() : Inner(kNode48) {}
+    uint8_t index[256] = {};
+    Node *children[48] = {};
+  };
+
+  struct Node256 : Inner {
+    Node256() : Inner(kNode256) {}
+    Node *children[256] = {};
+  };
+
+  static uint8_t At(const bytes_type &bytes, size_t i) {
+    return static_cast<uint8_t>(bytes[i]);
+  }
+
+  static bytes_type BytesOf(const Leaf *leaf) {
+    return Traits::Encode(leaf->data.first);
+  }
+
+  static Inner *AsInner(Node *node) { return static_cast<Inner *>(node); }
+
+  // Lexicographic comparison of a and b from byte from on.
+  static int Compare(const bytes_type &a, const bytes_type &b, size_t from) {
+    size_t n = std::min(a.size(), b.size());
+    for (size_t i = from; i < n; ++i) {
+      if (At(a, i) != At(b, i)) return At(a, i) < At(b, i) ? -1 : 1;
+    }
+    if (a.size() == b.size()) return 0;
+    return a.size() < b.size() ? -1 : 1;
+  }
+
+  // How many of the sorted keys of a Node4 or Node16 are below byte.
+  static unsigned Rank(const Node4 *node, unsigned byte) {
+    unsigned i = 0;
+    while (i < node->count && node->keys[i] < byte) ++i;
+    return i;
+  }
+
+  static unsigned Rank(const Node16 *node, unsigned byte) {
+    if (byte > 0xFF) return node->count;
+#if defined(__SSE2__)
+    // signed compare on bytes shifted by 0x80 is unsigned compare
+    __m128i flip = _mm_set1_epi8(static_cast<char>(0x80));
+    __m128i keys = _mm_xor_si128(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(node->keys)), flip);
+    __m128i needle =
+        _mm_xor_si128(_mm_set1_epi8(static_cast<char>(byte)), flip);
+    int below = _mm_movemask_epi8(_mm_cmplt_epi8(keys, needle));
+    return __builtin_popcount(below & ((1 << node->count) - 1));
+#else
+    unsigned i = 0;
+    while (i < node->count && node->keys[i] < byte) ++i;
+    return i;
+#endif
+  }
+
+  static Node **Child16(Node16 *node, uint8_t byte) {
+#if defined(__SSE2__)
+    __m128i keys =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(node->keys));
+    int match = _mm_movemask_epi8(
+        _mm_cmpeq_epi8(keys, _mm_set1_epi8(static_cast<char>(byte))));
+    match &= (1 << node->count) - 1;
+    return match ? &node->children[__builtin_ctz(match)] : nullptr;
+#else
+    for (unsigned i = 0; i < node->count; ++i) {
+      if (node->keys[i] == byte) return &node->children[i];
+    }
+    return nullptr;
+#endif
+  }
+
+  static Node **FindChild(Inner *node, uint8_t byte) {
+    switch (node->type) {
+      case kNode4: {
+        Node4 *n = static_cast<Node4 *>(node);
+        for (unsigned i = 0; i < n->count; ++i) {
+          if (n->keys[i] == byte) return &n->children[i];
+        }
+        return nullptr;
+      }
+      case kNode16:
+        return Child16(static_cast<Node16 *>(node), byte);
+      case kNode48: {
+        Node48 *n = static_cast<Node48 *>(node);
+        return n->index[byte] ? &n->children[n->index[byte] - 1] : nullptr;
+      }
+      default: {
+        Node256 *n = static_cast<Node256 *>(node);
+        return n->children[byte] ? &n->children[byte] : nullptr;
+      }
+    }
+  }
+
+  template <typename Small>
+  static Node *SmallFrom(const Small *node, unsigned from, unsigned *byte) {
+    unsigned i = Rank(node, from);
+    if (i == node->count) return nullptr;
+    if (byte) *byte = node->keys[i];
+    return node->children[i];
+  }
+
+  // The child with the smallest byte at or above from (up to 256), or null;
+  // its byte goes to *byte.
+  static Node *ChildFrom(const Inner *node, unsigned from,
+                         unsigned *byte = nullptr) {
+    switch (node->type) {
+      case kNode4:
+        return SmallFrom(static_cast<const Node4 *>(node), from, byte);
+      case kNode16:
+        return SmallFrom(static_cast<const Node16 *>(node), from, byte);
+      case kNode48: {
+        const Node48 *n = static_cast<const Node48 *>(node);
+        for (unsigned b = from; b < 256; ++b) {
+          if (!n->index[b]) continue;
+          if (byte) *byte = b;
+          return n->children[n->index[b] - 1];
+        }
+        return nullptr;
+      }
+      default: {
+        const Node256 *n = static_cast<const Node256 *>(node);
+        for (unsigned b = from; b < 256; ++b) {
+          if (!n->children[b]) continue;
+          if (byte) *byte = b;
+          return n->children[b];
+        }
+        return nullptr;
+      }
+    }
+  }
+
+  // The child with the largest byte below to (up to 256), or null.
+  static Node *ChildBefore(const Inner *node, unsigned to) {
+    switch (node->type) {
+      case kNode4: {
+        const Node4 *n = static_cast<const Node4 *>(node);
+        unsigned i = Rank(n, to);
+        return i ? n->children[i - 1] : nullptr;
+      }
+      case kNode16: {
+        const Node16 *n = static_cast<const Node16 *>(node);
+        unsigned i = Rank(n, to);
+        return i ? n->children[i - 1] : nullptr;
+      }
+      case kNode48: {
+        const Node48 *n = static_cast<const Node48 *>(node);
+        while (to-- > 0) {
+          if (n->index[to]) return n->children[n->index[to] - 1];
+        }
+        return nullptr;
+      }
+      default: {
+        const Node256 *n = static_cast<const Node256 *>(node);
+        while (to-- > 0) {
+          if (n->children[to]) return n->children[to];
+        }
+        return nullptr;
+      }
+    }
+  }
+
+  // Every inner node holds at least two entries, counting the terminal,
+  // and so at least one child.
+  static Leaf *MinLeaf(Node *node) {
+    while (node->type != kLeaf) {
+      Inner *inner = AsInner(node);
+      if (inner->terminal) return inner->terminal;
+      node = ChildFrom(inner, 0);
+    }
+    return static_cast<Leaf *>(node);
+  }
+
+  static Leaf *MaxLeaf(Node *node) {
+    while (node->type != kLeaf) node = ChildBefore(AsInner(node), 256);
+    return static_cast<Leaf *>(node);
+  }
+
+  // Byte i of node's prefix, which starts at depth in the key.
+  static uint8_t PrefixByte(Inner *node, size_t depth, size_t i) {
+    if (i < kMaxPrefix) return node->prefix[i];
+    return At(BytesOf(MinLeaf(node)), depth + i);
+  }
+
+  // How many bytes of node's prefix match bytes from depth on, stopping
+  // where bytes end.
+  static size_t PrefixMatch(Inner *node, const bytes_type &bytes,
+                            size_t depth) {
+    size_t limit = std::min<size_t>(node->prefix_len, bytes.size() - depth);
+    size_t stored = std::min<size_t>(limit, kMaxPrefix);
+    size_t i = 0;
+    for (; i < stored; ++i) {
+      if (node->prefix[i] != At(bytes, depth + i)) return i;
+    }
+    if (i < limit) {
+      bytes_type leaf = BytesOf(MinLeaf(node));
+      for (; i < limit; ++i) {
+        if (At(leaf, depth + i) != At(bytes, depth + i)) return i;
+      }
+    }
+    return i;
+  }
+
+  static void SetPrefix(Inner *node, const uint8_t *bytes, uint32_t len) {
+    node->prefix_len = len;
+    std::memcpy(node->prefix, bytes, std::min(len, kMaxPrefix));
+  }
+
+  static void CopyHeader(const Inner *from, Inner *to) {
+    to->count = from->count;
+    to->prefix_len = from->prefix_len;
+    std::memcpy(to->prefix, from->prefix, kMaxPrefix);
+    to->terminal = from->terminal;
+  }
+
+  template <typename Small>
+  static void InsertAt(Small *node, unsigned pos, uint8_t byte, Node *child) {
+    unsigned tail = node->count - pos;
+    std::memmove(node->keys + pos + 1, node->keys + pos, tail);
+    std::memmove(node->children + pos + 1, node->children + pos,
+                 tail * sizeof(Node *));
+    node->keys[pos] = byte;
+    node->children[pos] = child;
+    ++node->count;
+  }
+
+  template <typename Small>
+  static void RemoveAt(Small *node, unsigned pos) {
+    unsigned tail = node->count - pos - 1;
+    std::memmove(node->keys + pos, node->keys + pos + 1, tail);
+    std::memmove(node->children + pos, node->children + pos + 1,
+                 tail * sizeof(Node *));
+    --node->count;
+  }
+
+  // Adds child under byte, which must be free, moving *ref to the next
+  // node size up when it is full.
+  static void AddChild(Node **ref, uint8_t byte, Node *child) {
+    Inner *node = AsInner(*ref);
+    switch (node->type) {
+      case kNode4: {
+        Node4 *n = static_cast<Node4 *>(node);
+        if (n->count < 4) return InsertAt(n, Rank(n, byte), byte, child);
+        Node16 *bigger = new Node16;
+        CopyHeader(n, bigger);
+        std::memcpy(bigger->keys, n->keys, 4);
+        std::memcpy(bigger->children, n->children, 4 * sizeof(Node *));
+        *ref = bigger;
+        delete n;
+        return InsertAt(bigger, Rank(bigger, byte), byte, child);
+      }
+      case kNode16: {
+        Node16 *n = static_cast<Node16 *>(node);
+        if (n->count < 16) return InsertAt(n, Rank(n, byte), byte, child);
+        Node48 *bigger = new Node48;
+        CopyHeader(n, bigger);
+        for (unsigned i = 0; i < 16; ++i) {
+          bigger->index[n->keys[i]] = static_cast<uint8_t>(i + 1);
+          bigger->children[i] = n->children[i];
+        }
+        *ref = bigger;
+        delete n;
+        return AddChild(ref, byte, child);
+      }
+      case kNode48: {
+        Node48 *n = static_cast<Node48 *>(node);
+        if (n->count < 48) {
+          unsigned slot = 0;
+          while (n->children[slot]) ++slot;
+          n->children[slot] = child;
+          n->index[byte] = static_cast<uint8_t>(slot + 1);
+          ++n->count;
+          return;
+        }
+        Node256 *bigger = new Node256;
+        CopyHeader(n, bigger);
+        for (unsigned b = 0; b < 256; ++b) {
+          if (n->index[b]) bigger->children[b] = n->children[n->index[b] - 1];
+        }
+        *ref = bigger;
+        delete n;
+        return AddChild(ref, byte, child);
+      }
+      default: {
+        Node256 *n = static_cast<Node256 *>(node);
+        n->children[byte] = child;
+        ++n->count;
+        return;
+      }
+    }
+  }
+
+  // Takes the child under byte out of node without resizing it.
+  static void RemoveChild(Inner *node, uint8_t byte) {
+    switch (node->type) {
+      case kNode4: {
+        Node4 *n = static_cast<Node4 *>(node);
+        return RemoveAt(n, Rank(n, byte));
+      }
+      case kNode16: {
+        Node16 *n = static_cast<Node16 *>(node);
+        return RemoveAt(n, Rank(n, byte));
+      }
+      case kNode48: {
+        Node48 *n = static_cast<Node48 *>(node);
+        n->children[n->index[byte] - 1] = nullptr;
+        n->index[byte] = 0;
+        --n->count;
+        return;
+      }
+      default: {
+        Node256 *n = static_cast<Node256 *>(node);
+        n->children[byte] = nullptr;
+        --n->count;
+        return;
+      }
+    }
+  }
+
+  // Restores the invariants of *ref after it lost an entry: a node left
+  // with only a terminal or only one child is replaced by it, and a node
+  // well under its size class moves to the next one down. The thresholds
+  // sit below the growth points, so alternating inserts and erases at a
+  // boundary do not resize every time.
+  static void Compact(Node **ref) {
+    Inner *node = AsInner(*ref);
+    if (node->count == 0) {
+      *ref = node->terminal;
+      Delete(node);
+    } else if (node->count == 1 && !node->terminal) {
+      unsigned byte = 0;
+      Node *child = ChildFrom(node, 0, &byte);
+      if (child->type != kLeaf) {
+        Inner *inner = AsInner(child);
+        uint8_t merged[kMaxPrefix];
+        uint32_t len = std::min(node->prefix_len, kMaxPrefix);
+        std::memcpy(merged, node->prefix, len);
+        if (len < kMaxPrefix) merged[len++] = static_cast<uint8_t>(byte);
+        std::memcpy(merged + len, inner->prefix,
+                    std::min(kMaxPrefix - len, inner->prefix_len));
+        SetPrefix(inner, merged, node->prefix_len + 1 + inner->prefix_len);
+      }
+      *ref = child;
+      Delete(node);
+    } else if (node->type == kNode16 && node->count <= 3) {
+      Node16 *n = static_cast<Node16 *>(node);
+      Node4 *smaller = new Node4;
+      CopyHeader(n, smaller);
+      std::memcpy(smaller->keys, n->keys, n->count);
+      std::memcpy(smaller->children, n->children, n->count * sizeof(Node *));
+      *ref = smaller;
+      delete n;
+    } else if (node->type == kNode48 && node->count <= 12) {
+      Node48 *n = static_cast<Node48 *>(node);
+      Node16 *smaller = new Node16;
+      CopyHeader(n, smaller);
+      unsigned i = 0;
+      for (unsigned b = 0; b < 256; ++b) {
+        if (!n->index[b]) continue;
+        smaller->keys[i] = static_cast<uint8_t>(b);
+        smaller->children[i++] = n->children[n->index[b] - 1];
+      }
+      *ref = smaller;
+      delete n;
+    } else if (node->type == kNode256 && node->count <= 37) {
+      Node256 *n = static_cast<Node256 *>(node);
+      Node48 *smaller = new Node48;
+      CopyHeader(n, smaller);
+      unsigned slot = 0;
+      for (unsigned b = 0; b < 256; ++b) {
+        if (!n->children[b]) continue;
+        smaller->children[slot] = n->children[b];
+        smaller->index[b] = static_cast<uint8_t>(++slot);
+      }
+      *ref = smaller;
+      delete n;
+    }
+  }
+
+  // Frees node alone, as the type it really is.
+  static void Delete(Node *node) {
+    switch (node->type) {
+      case kLeaf:
+        delete static_cast<Leaf *>(node);
+        break;
+      case kNode4:
+        delete static_cast<Node4 *>(node);
+        break;
+      case kNode16:
+        delete static_cast<Node16 *>(node);
+        break;
+      case kNode48:
+        delete static_cast<Node48 *>(node);
+        break;
+      default:
+        delete static_cast<Node256 *>(node);
+        break;
+    }
+  }
+
+  // Recursion depth is bounded by the key length.
+  static void Free(Node *node) {
+    if (!node) return;
+    if (node->type != kLeaf) {
+      Inner *inner = AsInner(node);
+      unsigned byte = 0;
+      for (Node *child = ChildFrom(inner, 0, &byte); child;
+           child = ChildFrom(inner, byte + 1, &byte)) {
+        Free(child);
+      }
+      Free(inner->terminal);
+    }
+    Delete(node);
+  }
+
+  // Puts leaf into the sorted list right before next, or last.
+  void LinkBefore(Leaf *leaf, Leaf *next) {
+    leaf->next = next;
+    leaf->prev = next ? next->prev : tail_;
+    (leaf->prev ? leaf->prev->next : head_) = leaf;
+    (next ? next->prev : tail_) = leaf;
+    ++size_;
+  }
+
+  void Unlink(Leaf *leaf) {
+    (leaf->prev ? leaf->prev->next : head_) = leaf->next;
+    (leaf->next ? leaf->next->prev : tail_) = leaf->prev;
+    --size_;
+  }
+
+  Leaf *FindLeaf(const bytes_type &bytes) const {
+    Node *node = root_;
+    size_t depth = 0;
+    while (node && node->type != kLeaf) {
+      Inner *inner = AsInner(node);
+      // Only the stored prefix bytes are checked; the leaf compare at the
+      // end catches a mismatch in the rest.
+      size_t stored = std::min<size_t>(inner->prefix_len, kMaxPrefix);
+      if (depth + inner->prefix_len > bytes.size()) return nullptr;
+      for (size_t i = 0; i < stored; ++i) {
+        if (inner->prefix[i] != At(bytes, depth + i)) return nullptr;
+      }
+      depth += inner->prefix_len;
+      if (depth == bytes.size()) {
+        node = inner->terminal;
+      } else {
+        Node **child = FindChild(inner, At(bytes, depth++));
+        node = child ? *child : nullptr;
+      }
+    }
+    Leaf *leaf = static_cast<Leaf *>(node);
+    return leaf && BytesOf(leaf) == bytes ? leaf : nullptr;
+  }
+
+  // The existing leaf for key, or a new one, and whether it is new. Every
+  // new leaf is linked next to a neighbour found where it is attached.
+  std::pair<Leaf *, bool> Insert(const key_type &key,
+                                 const mapped_type &obj) {
+    bytes_type bytes = Traits::Encode(key);
+    Node **ref = &root_;
+    size_t depth = 0;
+    while (*ref && (*ref)->type != kLeaf) {
+      Inner *node = AsInner(*ref);
+      size_t match = PrefixMatch(node, bytes, depth);
+      if (match < node->prefix_len) {
+        return {SplitPrefix(ref, bytes, depth, match, key, obj), true};
+      }
+      depth += node->prefix_len;
+      if (depth == bytes.size()) {
+        if (node->terminal) return {node->terminal, false};
+        Leaf *leaf = new Leaf(key, obj);
+        LinkBefore(leaf, MinLeaf(ChildFrom(node, 0)));
+        node->terminal = leaf;
+        return {leaf, true};
+      }
+      uint8_t byte = At(bytes, depth);
+      Node **child = FindChild(node, byte);
+      if (!child) {
+        Leaf *leaf = new Leaf(key, obj);
+        // node has children, and none under byte, so one side has some
+        if (Node *after = ChildFrom(node, byte + 1u)) {
+          LinkBefore(leaf, MinLeaf(after));
+        } else {
+          LinkBefore(leaf, MaxLeaf(ChildBefore(node, byte))->next);
+        }
+        AddChild(ref, byte, leaf);
+        return {leaf, true};
+      }
+      ref = child;
+      ++depth;
+    }
+    if (!*ref) {
+      Leaf *leaf = new Leaf(key, obj);
+      LinkBefore(leaf, nullptr);
+      *ref = leaf;
+      return {leaf, true};
+    }
+    Leaf *old = static_cast<Leaf *>(*ref);
+    bytes_type old_bytes = BytesOf(old);
+    if (old_bytes == bytes) return {old, false};
+    return {SplitLeaf(ref, bytes, depth, key, obj), true};
+  }
+
+  // Replaces the leaf at *ref, whose key differs from bytes, with a Node4
+  // holding both; their common bytes past depth become its prefix.
+  Leaf *SplitLeaf(Node **ref, const bytes_type &bytes, size_t depth,
+                  const key_type &key, const mapped_type &obj) {
+    Leaf *old = static_cast<Leaf *>(*ref);
+    bytes_type old_bytes = BytesOf(old);
+    size_t end = depth;
+    while (end < bytes.size() && end < old_bytes.size() &&
+           At(bytes, end) == At(old_bytes, end)) {
+      ++end;
+    }
+    Node4 *parent = new Node4;
+    parent->prefix_len = static_cast<uint32_t>(end - depth);
+    for (size_t i = 0; i < std::min<size_t>(end - depth, kMaxPrefix); ++i) {
+      parent->prefix[i] = At(bytes, depth + i);
+    }
+    Leaf *leaf = new Leaf(key, obj);
+    *ref = parent;
+    if (!kFixedWidth && end == bytes.size()) {
+      parent->terminal = leaf;
+      AddChild(ref, At(old_bytes, end), old);
+    } else if (!kFixedWidth && end == old_bytes.size()) {
+      parent->terminal = old;
+      AddChild(ref, At(bytes, end), leaf);
+    } else {
+      AddChild(ref, At(old_bytes, end), old);
+      AddChild(ref, At(bytes, end), leaf);
+    }
+    LinkBefore(leaf, Compare(bytes, old_bytes, depth) < 0 ? old : old->next);
+    return leaf;
+  }
+
+  // Puts a Node4 above *ref where bytes leave its prefix after match
+  // bytes, holding the old node and a new leaf.
+  Leaf *SplitPrefix(Node **ref, const bytes_type &bytes, size_t depth,
+                    size_t match, const key_type &key,
+                    const mapped_type &obj) {
+    Inner *node = AsInner(*ref);
+    Node4 *parent = new Node4;
+    SetPrefix(parent, node->prefix, static_cast<uint32_t>(match));
+    uint8_t split = PrefixByte(node, depth, match);
+    uint32_t rest = node->prefix_len - static_cast<uint32_t>(match) - 1;
+    uint8_t shifted[kMaxPrefix];
+    for (uint32_t i = 0; i < std::min(rest, kMaxPrefix); ++i) {
+      shifted[i] = PrefixByte(node, depth, match + 1 + i);
+    }
+    Leaf *first = MinLeaf(node);
+    Leaf *after_last = MaxLeaf(node)->next;
+    SetPrefix(node, shifted, rest);
+    Leaf *leaf = new Leaf(key, obj);
+    *ref = parent;
+    AddChild(ref, split, node);
+    if (depth + match == bytes.size()) {
+      parent->terminal = leaf;
+      LinkBefore(leaf, first);
+    } else {
+      uint8_t byte = At(bytes, depth + match);
+      AddChild(ref, byte, leaf);
+      LinkBefore(leaf, byte < split ? first : after_last);
+    }
+    return leaf;
+  }
+
+  size_type Erase(const bytes_type &bytes) {
+    if (!root_) return 0;
+    if (root_->type == kLeaf) {
+      Leaf *leaf = static_cast<Leaf *>(root_);
+      if (!(BytesOf(leaf) == bytes)) return 0;
+      root_ = nullptr;
+      Drop(leaf);
+      return 1;
+    }
+    Node **ref = &root_;
+    size_t depth = 0;
+    while (true) {
+      Inner *node = AsInner(*ref);
+      if (PrefixMatch(node, bytes, depth) < node->prefix_len) return 0;
+      depth += node->prefix_len;
+      if (depth == bytes.size()) {
+        Leaf *leaf = node->terminal;
+        if (!leaf) return 0;
+        node->terminal = nullptr;
+        Drop(leaf);
+        Compact(ref);
+        return 1;
+      }
+      uint8_t byte = At(bytes, depth++);
+      Node **child = FindChild(node, byte);
+      if (!child) return 0;
+      if ((*child)->type != kLeaf) {
+        ref = child;
+        continue;
+      }
+      Leaf *leaf = static_cast<Leaf *>(*child);
+      if (!(BytesOf(leaf) == bytes)) return 0;
+      RemoveChild(node, byte);
+      Drop(leaf);
+      Compact(ref);
+      return 1;
+    }
+  }
+
+  void Drop(Leaf *leaf) {
+    Unlink(leaf);
+    delete leaf;
+  }
+
+  // Where the descent for bytes leaves the tree, the answer is the
+  // smallest leaf of the next subtree over, or the one after the largest
+  // leaf of the previous one; nothing can sit between them and bytes.
+  Leaf *LowerBound(const bytes_type &bytes) const {
+    Node *node = root_;
+    size_t depth = 0;
+    while (node && node->type != kLeaf) {
+      Inner *inner = AsInner(node);
+      size_t match = PrefixMatch(inner, bytes, depth);
+      if (depth + match == bytes.size()) {
+        return match == inner->prefix_len && inner->terminal
+                   ? inner->terminal
+                   : MinLeaf(inner);
+      }
+      if (match < inner->prefix_len) {
+        return At(bytes, depth + match) < PrefixByte(inner, depth, match)
+                   ? MinLeaf(inner)
+                   : MaxLeaf(inner)->next;
+      }
+      depth += inner->prefix_len;
+      uint8_t byte = At(bytes, depth++);
+      if (Node **child = FindChild(inner, byte)) {
+        node = *child;
+      } else if (Node *after = ChildFrom(inner, byte + 1u)) {
+        return MinLeaf(after);
+      } else {
+        return MaxLeaf(ChildBefore(inner, byte))->next;
+      }
+    }
+    Leaf *leaf = static_cast<Leaf *>(node);
+    if (!leaf || Compare(BytesOf(leaf), bytes, 0) >= 0) return leaf;
+    return leaf->next;
+  }
+
+  // The leaves [first, last) under the subtree whose keys begin with
+  // bytes.
+  std::pair<Leaf *, Leaf *> PrefixRange(const bytes_type &bytes) const {
+    Node *node = root_;
+    size_t depth = 0;
+    while (node && node->type != kLeaf) {
+      Inner *inner = AsInner(node);
+      size_t match = PrefixMatch(inner, bytes, depth);
+      if (depth + match == bytes.size()) {
+        return {MinLeaf(inner), MaxLeaf(inner)->next};
+      }
+      if (match < inner->prefix_len) return {nullptr, nullptr};
+      depth += inner->prefix_len;
+      Node **child = FindChild(inner, At(bytes, depth++));
+      node = child ? *child : nullptr;
+    }
+    Leaf *leaf = static_cast<Leaf *>(node);
+    if (leaf) {
+      bytes_type leaf_bytes = BytesOf(leaf);
+      if (leaf_bytes.size() >= bytes.size() &&
+          std::equal(bytes.begin(), bytes.end(), leaf_bytes.begin())) {
+        return {leaf, leaf->next};
+      }
+    }
+    return {nullptr, nullptr};
+  }
+
+  Node *root_ = nullptr;
+  Leaf *head_ = nullptr;
+  Leaf *tail_ = nullptr;
+  size_type size_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_ART_MAP_H_
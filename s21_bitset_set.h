@@ -0,0 +1,245 @@
+#ifndef S21_CONTAINERS_SRC_S21_BITSET_SET_H_
+#define S21_CONTAINERS_SRC_S21_BITSET_SET_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_dynamic_bitset.h"
+
+namespace s21 {
+
+// Set of small non-negative integers kept as one bit per possible key,
+// for domains like ids in 0..65535 where a tree node per element would
+// cost some 48 bytes against one bit here. The bit array grows to the
+// largest key ever inserted and never shrinks, so memory follows the size
+// of the domain, not the number of elements; for a few keys spread over a
+// wide range s21::set is the better choice.
+//
+// The interface follows s21::set. Dereferencing an iterator yields the key
+// by value, as there is no stored element to refer to. unite, intersect
+// and subtract work a 64-bit word at a time. Keys run from 0 to
+// max_size() - 1, which is at most 2^40 - 1: negative keys and larger ones
+// are never present, and inserting one throws std::out_of_range.
+template <typename Key = int>
+class bitset_set {
+  static_assert(std::is_integral_v<Key> && !std::is_same_v<Key, bool>,
+                "integer keys only");
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = Key;
+  using const_reference = Key;
+  using size_type = size_t;
+
+  class BitsetSetIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = Key;
+
+    BitsetSetIterator() = default;
+
+    reference operator*() const { return static_cast<Key>(pos_); }
+
+    BitsetSetIterator &operator++() {
+      pos_ = bits_->find_next(pos_);
+      return *this;
+    }
+
+    BitsetSetIterator operator++(int) {
+      BitsetSetIterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    // --end() is the largest key.
+    BitsetSetIterator &operator--() {
+      pos_ = pos_ == kEnd ? bits_->find_last() : bits_->find_prev(pos_);
+      return *this;
+    }
+
+    BitsetSetIterator operator--(int) {
+      BitsetSetIterator old = *this;
+      --*this;
+      return old;
+    }
+
+    bool operator==(const BitsetSetIterator &other) const {
+      return pos_ == other.pos_;
+    }
+    bool operator!=(const BitsetSetIterator &other) const {
+      return pos_ != other.pos_;
+    }
+
+   private:
+    BitsetSetIterator(const dynamic_bitset *bits, size_type pos)
+        : bits_(bits), pos_(pos) {}
+
+    const dynamic_bitset *bits_ = nullptr;
+    size_type pos_ = kEnd;
+    friend class bitset_set;
+  };
+
+  using iterator = BitsetSetIterator;
+  using const_iterator = BitsetSetIterator;
+
+  bitset_set() = default;
+
+  // Room for the keys 0..domain - 1 up front.
+  explicit bitset_set(size_type domain) : bits_(domain) {}
+
+  bitset_set(std::initializer_list<value_type> const &items) {
+    for (value_type item : items) insert(item);
+  }
+
+  iterator begin() const { return iterator(&bits_, bits_.find_first()); }
+  iterator end() const { return iterator(&bits_, kEnd); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const noexcept { return count_ == 0; }
+  size_type size() const noexcept { return count_; }
+  size_type max_size() const noexcept { return kDomain; }
+
+  // Keeps the bit array, so refilling the set does not allocate.
+  void clear() noexcept {
+    bits_.reset();
+    count_ = 0;
+  }
+
+  void swap(bitset_set &other) noexcept {
+    bits_.swap(other.bits_);
+    std::swap(count_, other.count_);
+  }
+
+  std::pair<iterator, bool> insert(value_type key) {
+    if (!InDomain(key)) throw std::out_of_range("Key out of range");
+    size_type pos = static_cast<size_type>(key);
+    if (pos >= bits_.size()) Grow(pos);
+    bool added = !bits_[pos];
+    if (added) {
+      bits_.set(pos);
+      ++count_;
+    }
+    return {iterator(&bits_, pos), added};
+  }
+
+  void erase(iterator pos) {
+    if (pos != end()) erase(*pos);
+  }
+
+  size_type erase(const key_type &key) {
+    if (!contains(key)) return 0;
+    bits_.reset(static_cast<size_type>(key));
+    --count_;
+    return 1;
+  }
+
+  iterator find(const key_type &key) const {
+    return contains(key) ? iterator(&bits_, static_cast<size_type>(key))
+                         : end();
+  }
+
+  bool contains(const key_type &key) const {
+    if (!InDomain(key)) return false;
+    size_type pos = static_cast<size_type>(key);
+    return pos < bits_.size() && bits_[pos];
+  }
+
+  size_type count(const key_type &key) const { return contains(key); }
+
+  // First element not ordered before key, or end().
+  iterator lower_bound(const key_type &key) const {
+    if (!InDomain(key)) return key > 0 ? end() : begin();
+    size_type pos = static_cast<size_type>(key);
+    if (contains(key)) return iterator(&bits_, pos);
+    return iterator(&bits_, bits_.find_next(pos));
+  }
+
+  // First element ordered after key, or end().
+  iterator upper_bound(const key_type &key) const {
+    if (!InDomain(key)) return key > 0 ? end() : begin();
+    return iterator(&bits_, bits_.find_next(static_cast<size_type>(key)));
+  }
+
+  // Moves the keys of other missing here into this set; the others stay
+  // in other.
+  void merge(bitset_set &other) {
+    dynamic_bitset both = other.bits_ & bits_;
+    bits_ |= other.bits_;
+    other.bits_.swap(both);
+    Recount();
+    other.Recount();
+  }
+
+  // In-place union, intersection and difference with other, which is left
+  // untouched.
+  void unite(const bitset_set &other) {
+    bits_ |= other.bits_;
+    Recount();
+  }
+
+  void intersect(const bitset_set &other) {
+    bits_ &= other.bits_;
+    Recount();
+  }
+
+  void subtract(const bitset_set &other) {
+    bits_ -= other.bits_;
+    Recount();
+  }
+
+  // Equal when they hold the same keys, whatever room each has reserved.
+  bool operator==(const bitset_set &other) const {
+    return count_ == other.count_ && bits_.is_subset_of(other.bits_);
+  }
+  bool operator!=(const bitset_set &other) const {
+    return !(*this == other);
+  }
+
+  // The bits themselves, bit k standing for key k.
+  const dynamic_bitset &bits() const noexcept { return bits_; }
+
+ private:
+  static constexpr size_type kEnd = dynamic_bitset::npos;
+
+  // Past 2^40 keys the bit array alone would take 128 GiB, so the domain
+  // stops there instead of leaving the allocator to refuse. This also keeps
+  // keys clear of kEnd, which marks end().
+  static constexpr size_type kMaxKeys = size_type(1) << 40;
+  static constexpr size_type kLargest =
+      static_cast<size_type>(std::numeric_limits<Key>::max());
+  static constexpr size_type kDomain =
+      kLargest < kMaxKeys ? kLargest + 1 : kMaxKeys;
+
+  static bool InDomain(const key_type &key) {
+    if constexpr (std::is_signed_v<Key>) {
+      if (key < 0) return false;
+    }
+    return static_cast<size_type>(key) < kDomain;
+  }
+
+  // Doubles the array, at least up to pos, so ascending inserts stay
+  // amortized O(1).
+  void Grow(size_type pos) {
+    bits_.resize(std::max(pos + 1, 2 * bits_.size()));
+  }
+
+  void Recount() { count_ = bits_.count(); }
+
+  dynamic_bitset bits_;
+  size_type count_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_BITSET_SET_H_
@@ -0,0 +1,292 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONCURRENT_HASH_MAP_H_
+#define S21_CONTAINERS_SRC_S21_CONCURRENT_HASH_MAP_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// Hash map for many threads inserting and updating at once. Keys are
+// spread over a fixed number of stripes by the top bits of their hash;
+// each stripe is its own linear-probing table behind its own mutex, so
+// operations on different stripes never wait for each other and a stripe
+// that fills up rehashes alone while the rest keep working.
+//
+// update(key, fn) runs fn on the value under the stripe lock, which makes
+// read-modify-write sequences such as counters atomic. fn and the
+// for_each visitor must not call back into the map. size() is exact only
+// while no writer is running.
+template <typename K, typename V, typename Hash = std::hash<K>,
+          typename KeyEqual = std::equal_to<K>>
+class ConcurrentHashMap {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using size_type = size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  static constexpr size_type kDefaultStripes = 64;
+
+  // stripes is rounded up to a power of two.
+  explicit ConcurrentHashMap(size_type stripes = kDefaultStripes,
+                             const Hash &hash = Hash(),
+                             const KeyEqual &equal = KeyEqual())
+      : hash_(hash), equal_(equal) {
+    while ((size_type(1) << bits_) < stripes) ++bits_;
+    stripes_ = new Stripe[size_type(1) << bits_];
+  }
+
+  ConcurrentHashMap(const ConcurrentHashMap &) = delete;
+  ConcurrentHashMap &operator=(const ConcurrentHashMap &) = delete;
+
+  ~ConcurrentHashMap() {
+    clear();
+    delete[] stripes_;
+  }
+
+  size_type stripe_count() const noexcept { return size_type(1) << bits_; }
+
+  size_type size() const noexcept {
+    size_type total = 0;
+    for (size_type i = 0; i < stripe_count(); ++i) {
+      total += stripes_[i].count.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  // Returns false, leaving the map alone, when key is already present.
+  bool insert(const key_type &key, const mapped_type &value) {
+    uint64_t hash = HashOf(key);
+    Stripe &stripe = StripeOf(hash);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    if (Find(stripe, key, hash) != kNone) return false;
+    Add(stripe, key, hash, value);
+    return true;
+  }
+
+  // Returns true when key was added rather than overwritten.
+  bool insert_or_assign(const key_type &key, const mapped_type &value) {
+    uint64_t hash = HashOf(key);
+    Stripe &stripe = StripeOf(hash);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    size_type at = Find(stripe, key, hash);
+    if (at != kNone) {
+      stripe.slots[at].entry().value = value;
+      return false;
+    }
+    Add(stripe, key, hash, value);
+    return true;
+  }
+
+  // Calls fn(V&) on the value for key, first inserting a value-initialized
+  // V when key is absent, all under one lock. Returns true when key was
+  // added.
+  template <typename Fn>
+  bool update(const key_type &key, Fn fn) {
+    uint64_t hash = HashOf(key);
+    Stripe &stripe = StripeOf(hash);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    size_type at = Find(stripe, key, hash);
+    bool added = at == kNone;
+    if (added) at = Add(stripe, key, hash, mapped_type());
+    fn(stripe.slots[at].entry().value);
+    return added;
+  }
+
+  // Copies the value for key into value; false when key is absent.
+  bool get(const key_type &key, mapped_type &value) const {
+    uint64_t hash = HashOf(key);
+    Stripe &stripe = StripeOf(hash);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    size_type at = Find(stripe, key, hash);
+    if (at == kNone) return false;
+    value = stripe.slots[at].entry().value;
+    return true;
+  }
+
+  bool contains(const key_type &key) const {
+    uint64_t hash = HashOf(key);
+    Stripe &stripe = StripeOf(hash);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    return Find(stripe, key, hash) != kNone;
+  }
+
+  bool erase(const key_type &key) {
+    uint64_t hash = HashOf(key);
+    Stripe &stripe = StripeOf(hash);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    size_type at = Find(stripe, key, hash);
+    if (at == kNone) return false;
+    Remove(stripe, at);
+    return true;
+  }
+
+  // Empties one stripe at a time; keys inserted meanwhile may survive.
+  void clear() {
+    for (size_type i = 0; i < stripe_count(); ++i) {
+      Stripe &stripe = stripes_[i];
+      std::lock_guard<std::mutex> lock(stripe.mutex);
+      Release(stripe);
+    }
+  }
+
+  // Calls visit(const K&, V&) on every entry, locking one stripe at a
+  // time, so it sees each stripe consistent but not the map as a whole.
+  template <typename Visitor>
+  void for_each(Visitor visit) {
+    for (size_type i = 0; i < stripe_count(); ++i) {
+      Stripe &stripe = stripes_[i];
+      std::lock_guard<std::mutex> lock(stripe.mutex);
+      for (size_type at = 0; at < stripe.capacity; ++at) {
+        Slot &slot = stripe.slots[at];
+        if (slot.hash) visit(slot.entry().key, slot.entry().value);
+      }
+    }
+  }
+
+ private:
+  struct Entry {
+    K key;
+    V value;
+  };
+
+  // The hash doubles as the occupancy mark (HashOf() never returns 0), so
+  // a probe reads one cache line per slot. The entry lives in raw storage
+  // and is only constructed while the slot is taken.
+  struct Slot {
+    uint64_t hash = 0;
+    alignas(Entry) unsigned char storage[sizeof(Entry)];
+
+    Entry &entry() {
+      return *std::launder(reinterpret_cast<Entry *>(storage));
+    }
+    const Entry &entry() const {
+      return *std::launder(reinterpret_cast<const Entry *>(storage));
+    }
+  };
+
+  // Own cache line each, so threads on neighbouring stripes do not
+  // bounce each other's lock.
+  struct alignas(64) Stripe {
+    std::mutex mutex;
+    Slot *slots = nullptr;
+    size_type capacity = 0;  // zero or a power of two
+    std::atomic<size_type> count{0};
+  };
+
+  static constexpr size_type kNone = ~size_type(0);
+  static constexpr size_type kMinCapacity = 8;
+
+  // std::hash of an integer is usually the integer itself, so the bits are
+  // mixed (the MurmurHash3 finalizer) before the top ones pick the stripe
+  // and the bottom ones the slot.
+  uint64_t HashOf(const key_type &key) const {
+    uint64_t h = static_cast<uint64_t>(hash_(key));
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h ? h : 1;
+  }
+
+  Stripe &StripeOf(uint64_t hash) const {
+    return stripes_[bits_ ? hash >> (64 - bits_) : 0];
+  }
+
+  size_type Find(const Stripe &stripe, const key_type &key,
+                 uint64_t hash) const {
+    if (stripe.capacity == 0) return kNone;
+    size_type mask = stripe.capacity - 1;
+    for (size_type at = hash & mask; stripe.slots[at].hash;
+         at = (at + 1) & mask) {
+      const Slot &slot = stripe.slots[at];
+      if (slot.hash == hash && equal_(slot.entry().key, key)) return at;
+    }
+    return kNone;
+  }
+
+  // key must be absent. Grows the stripe past 3/4 full.
+  size_type Add(Stripe &stripe, const key_type &key, uint64_t hash,
+                const mapped_type &value) {
+    size_type count = stripe.count.load(std::memory_order_relaxed);
+    if ((count + 1) * 4 > stripe.capacity * 3) Grow(stripe);
+    size_type at = FreeSlot(stripe.slots, stripe.capacity, hash);
+    new (stripe.slots[at].storage) Entry{key, value};
+    stripe.slots[at].hash = hash;
+    stripe.count.store(count + 1, std::memory_order_relaxed);
+    return at;
+  }
+
+  static size_type FreeSlot(const Slot *slots, size_type capacity,
+                            uint64_t hash) {
+    size_type mask = capacity - 1;
+    size_type at = hash & mask;
+    while (slots[at].hash) at = (at + 1) & mask;
+    return at;
+  }
+
+  static void Move(Slot &from, Slot &to) {
+    new (to.storage) Entry(std::move(from.entry()));
+    to.hash = from.hash;
+    from.entry().~Entry();
+    from.hash = 0;
+  }
+
+  static void Grow(Stripe &stripe) {
+    size_type capacity =
+        stripe.capacity ? stripe.capacity * 2 : kMinCapacity;
+    Slot *slots = new Slot[capacity];
+    for (size_type at = 0; at < stripe.capacity; ++at) {
+      Slot &slot = stripe.slots[at];
+      if (slot.hash) Move(slot, slots[FreeSlot(slots, capacity, slot.hash)]);
+    }
+    delete[] stripe.slots;
+    stripe.slots = slots;
+    stripe.capacity = capacity;
+  }
+
+  // Backward-shift deletion: later members of the probe run move up into
+  // the hole, so lookups never need tombstones.
+  static void Remove(Stripe &stripe, size_type hole) {
+    size_type mask = stripe.capacity - 1;
+    stripe.slots[hole].entry().~Entry();
+    stripe.slots[hole].hash = 0;
+    for (size_type at = (hole + 1) & mask; stripe.slots[at].hash;
+         at = (at + 1) & mask) {
+      size_type home = stripe.slots[at].hash & mask;
+      // stays unless the hole lies between its home slot and it
+      if (((at - home) & mask) < ((at - hole) & mask)) continue;
+      Move(stripe.slots[at], stripe.slots[hole]);
+      hole = at;
+    }
+    stripe.count.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  static void Release(Stripe &stripe) {
+    for (size_type at = 0; at < stripe.capacity; ++at) {
+      if (stripe.slots[at].hash) stripe.slots[at].entry().~Entry();
+    }
+    delete[] stripe.slots;
+    stripe.slots = nullptr;
+    stripe.capacity = 0;
+    stripe.count.store(0, std::memory_order_relaxed);
+  }
+
+  Stripe *stripes_ = nullptr;
+  unsigned bits_ = 0;
+  Hash hash_;
+  KeyEqual equal_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_CONCURRENT_HASH_MAP_H_
@@ -0,0 +1,160 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONCURRENT_MAP_H_
+#define S21_CONTAINERS_SRC_S21_CONCURRENT_MAP_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "s21_epoch.h"
+#include "s21_persistent_map.h"
+
+namespace s21 {
+
+// Sorted map for many readers and an occasional writer. The contents are
+// a persistent_map version behind an atomic pointer: a writer builds the
+// next version under a mutex, sharing everything but the changed path,
+// and publishes it with a single store. Readers never lock or write shared
+// memory; they pin the version they loaded with an epoch guard, and the
+// writer frees replaced versions once no reader can still hold them.
+//
+// Every read sees one whole version, and snapshot() hands out that
+// version itself, so multi-key reads stay consistent for as long as the
+// caller likes. update() applies several changes as one publication.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class ConcurrentMap {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using size_type = size_t;
+  using snapshot_type = persistent_map<Key, T, Compare>;
+
+  ConcurrentMap() : current_(new snapshot_type()) {}
+  ConcurrentMap(const ConcurrentMap &) = delete;
+  ConcurrentMap &operator=(const ConcurrentMap &) = delete;
+
+  // No reader may be inside the map any more.
+  ~ConcurrentMap() {
+    delete current_.load(std::memory_order_relaxed);
+    for (const Retired &old : retired_) delete old.version;
+  }
+
+  size_type size() const {
+    epoch::ReadGuard guard;
+    return Current()->size();
+  }
+
+  bool empty() const { return size() == 0; }
+
+  bool contains(const key_type &key) const {
+    epoch::ReadGuard guard;
+    return Current()->contains(key);
+  }
+
+  // Copies the value for key into value; false when key is absent.
+  bool get(const key_type &key, mapped_type &value) const {
+    return visit(key, [&value](const mapped_type &found) { value = found; });
+  }
+
+  // Calls visit(const T&) on the value for key while it is pinned, so
+  // nothing is copied; false when key is absent. visit must not write to
+  // this map.
+  template <typename Visitor>
+  bool visit(const key_type &key, Visitor visit) const {
+    epoch::ReadGuard guard;
+    const snapshot_type *version = Current();
+    auto it = version->find(key);
+    if (it == version->end()) return false;
+    visit(it->second);
+    return true;
+  }
+
+  // The current version, kept alive by the copy however long it is held.
+  snapshot_type snapshot() const {
+    epoch::ReadGuard guard;
+    return *Current();
+  }
+
+  // Each returns whether the map changed the way its name says.
+  bool insert(const key_type &key, const mapped_type &obj) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const snapshot_type *old = Latest();
+    if (old->contains(key)) return false;
+    Publish(old->insert(key, obj));
+    return true;
+  }
+
+  bool insert_or_assign(const key_type &key, const mapped_type &obj) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const snapshot_type *old = Latest();
+    bool added = !old->contains(key);
+    Publish(old->insert_or_assign(key, obj));
+    return added;
+  }
+
+  bool erase(const key_type &key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const snapshot_type *old = Latest();
+    if (!old->contains(key)) return false;
+    Publish(old->erase(key));
+    return true;
+  }
+
+  // Publishes edit(current) in one step, edit taking and returning a
+  // snapshot_type, so readers see all of its changes or none.
+  template <typename Edit>
+  void update(Edit edit) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Publish(edit(*Latest()));
+  }
+
+  void clear() {
+    update([](const snapshot_type &) { return snapshot_type(); });
+  }
+
+ private:
+  struct Retired {
+    const snapshot_type *version;
+    uint64_t epoch;
+  };
+
+  const snapshot_type *Current() const {
+    return current_.load(std::memory_order_seq_cst);
+  }
+
+  // Only writers free versions, so under mutex_ no guard is needed.
+  const snapshot_type *Latest() const {
+    return current_.load(std::memory_order_relaxed);
+  }
+
+  void Publish(snapshot_type next) {
+    const snapshot_type *old = Latest();
+    current_.store(new snapshot_type(std::move(next)),
+                   std::memory_order_seq_cst);
+    retired_.push_back({old, epoch::Domain::Global().Retire()});
+    Reclaim();
+  }
+
+  void Reclaim() {
+    size_type kept = 0;
+    for (const Retired &old : retired_) {
+      if (epoch::Domain::Global().Expired(old.epoch)) {
+        delete old.version;
+      } else {
+        retired_[kept++] = old;
+      }
+    }
+    retired_.resize(kept);
+  }
+
+  std::atomic<const snapshot_type *> current_;
+  std::mutex mutex_;
+  std::vector<Retired> retired_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_CONCURRENT_MAP_H_
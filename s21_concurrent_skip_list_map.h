@@ -0,0 +1,420 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONCURRENT_SKIP_LIST_MAP_H_
+#define S21_CONTAINERS_SRC_S21_CONCURRENT_SKIP_LIST_MAP_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "s21_epoch.h"
+
+namespace s21 {
+
+// Sorted map that any number of threads may insert into, erase from and
+// read at once, without locks. It is a skip list whose links carry a mark
+// bit (Fraser's / Herlihy and Shavit's design): erase first marks every
+// link out of the node, which removes it logically at the moment level 0
+// is marked, and the node is then snipped out by whichever traversal next
+// passes it. Unlinked nodes are freed through the shared epoch scheme, so
+// a reader holding one never sees it reused.
+//
+// Values are fixed once inserted. Iterators walk level 0 in key order,
+// skipping erased entries; each pins the epoch of the thread that made it
+// and must stay on that thread. They are weakly consistent: entries added
+// or erased during the walk may or may not show up.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class ConcurrentSkipListMap {
+  struct Node;
+  using Link = std::atomic<uintptr_t>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = const value_type &;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  static constexpr int kMaxHeight = 32;
+
+  class SkipListIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ConcurrentSkipListMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    SkipListIterator() = default;
+    // every copy pins the epoch on its own
+    SkipListIterator(const SkipListIterator &other) : node_(other.node_) {}
+    SkipListIterator &operator=(const SkipListIterator &other) {
+      node_ = other.node_;
+      return *this;
+    }
+
+    reference operator*() const { return node_->data; }
+    pointer operator->() const { return &node_->data; }
+
+    SkipListIterator &operator++() {
+      node_ = FirstLive(Pointer(node_->links()[0].load()));
+      return *this;
+    }
+
+    SkipListIterator operator++(int) {
+      SkipListIterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    bool operator==(const SkipListIterator &other) const {
+      return node_ == other.node_;
+    }
+    bool operator!=(const SkipListIterator &other) const {
+      return node_ != other.node_;
+    }
+
+   private:
+    explicit SkipListIterator(Node *node) : node_(node) {}
+
+    epoch::ReadGuard guard_;
+    Node *node_ = nullptr;
+    friend class ConcurrentSkipListMap;
+  };
+
+  using iterator = SkipListIterator;
+  using const_iterator = SkipListIterator;
+
+  ConcurrentSkipListMap() {
+    for (Link &link : head_) link.store(0, std::memory_order_relaxed);
+  }
+
+  explicit ConcurrentSkipListMap(const Compare &comp)
+      : ConcurrentSkipListMap() {
+    compare_ = comp;
+  }
+
+  ConcurrentSkipListMap(const ConcurrentSkipListMap &) = delete;
+  ConcurrentSkipListMap &operator=(const ConcurrentSkipListMap &) = delete;
+
+  // No other thread may be using the map any more.
+  ~ConcurrentSkipListMap() {
+    Node *node = Pointer(head_[0].load(std::memory_order_relaxed));
+    while (node) {
+      Node *next = Pointer(node->links()[0].load(std::memory_order_relaxed));
+      Destroy(node);
+      node = next;
+    }
+    for (const Retired &old : retired_) Destroy(old.node);
+  }
+
+  iterator begin() const {
+    iterator it;
+    it.node_ = FirstLive(Pointer(head_[0].load()));
+    return it;
+  }
+  iterator end() const { return iterator(); }
+
+  // Exact while no writer is running.
+  size_type size() const noexcept {
+    return count_.load(std::memory_order_relaxed);
+  }
+  bool empty() const noexcept { return size() == 0; }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return insert(value.first, value.second);
+  }
+
+  // Adds key unless it is present; either way the iterator points at the
+  // entry for key.
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    iterator it;
+    const Link *preds[kMaxHeight];
+    Node *succs[kMaxHeight];
+    int height = RandomHeight();
+    Node *node = nullptr;
+    while (true) {
+      if (Find(key, preds, succs)) {
+        if (node) Destroy(node);
+        it.node_ = succs[0];
+        return {it, false};
+      }
+      if (!node) node = Create(key, obj, height);
+      for (int level = 0; level < height; ++level) {
+        node->links()[level].store(Address(succs[level]),
+                                   std::memory_order_relaxed);
+      }
+      uintptr_t expected = Address(succs[0]);
+      if (Mutable(preds[0])->compare_exchange_strong(expected,
+                                                     Address(node))) {
+        break;
+      }
+    }
+    count_.fetch_add(1, std::memory_order_relaxed);
+    RaiseHeight(height);
+    LinkUpperLevels(node, key, height, preds, succs);
+    it.node_ = node;
+    return {it, true};
+  }
+
+  // Returns how many entries went, 0 or 1.
+  size_type erase(const key_type &key) {
+    epoch::ReadGuard guard;
+    const Link *preds[kMaxHeight];
+    Node *succs[kMaxHeight];
+    if (!Find(key, preds, succs)) return 0;
+    Node *node = succs[0];
+    Link *links = node->links();
+    for (int level = node->height - 1; level > 0; --level) {
+      links[level].fetch_or(kMark);
+    }
+    uintptr_t old = links[0].fetch_or(kMark);
+    // only the thread that marks level 0 has erased the entry
+    if (old & kMark) return 0;
+    count_.fetch_sub(1, std::memory_order_relaxed);
+    // snips it everywhere; the snip at level 0 drops the list's ownership
+    Find(key, preds, succs);
+    return 1;
+  }
+
+  iterator find(const key_type &key) const {
+    iterator it;
+    it.node_ = FindNode(key);
+    return it;
+  }
+
+  bool contains(const key_type &key) const {
+    epoch::ReadGuard guard;
+    return FindNode(key);
+  }
+
+  size_type count(const key_type &key) const { return contains(key); }
+
+  // Copies the value for key into value; false when key is absent.
+  bool get(const key_type &key, mapped_type &value) const {
+    epoch::ReadGuard guard;
+    const Node *node = FindNode(key);
+    if (!node) return false;
+    value = node->data.second;
+    return true;
+  }
+
+  // Throws std::out_of_range when key is absent.
+  mapped_type at(const key_type &key) const {
+    mapped_type value;
+    if (!get(key, value)) throw std::out_of_range("Key not found");
+    return value;
+  }
+
+  // First live entry not ordered before key, or end().
+  iterator lower_bound(const key_type &key) const {
+    iterator it;
+    it.node_ = LowerBound(key);
+    return it;
+  }
+
+  // Erases every entry one by one; entries added meanwhile may survive.
+  void clear() {
+    for (iterator it = begin(); it != end(); ++it) erase(it->first);
+  }
+
+  key_compare key_comp() const { return compare_; }
+
+ private:
+  // Links are pointers with the low bit set once the node they leave is
+  // being erased.
+  static constexpr uintptr_t kMark = 1;
+
+  struct alignas(Link) Node {
+    Node(const key_type &key, const mapped_type &obj, int levels)
+        : data(key, obj), height(levels) {}
+
+    // height links, stored right after the node
+    Link *links() { return reinterpret_cast<Link *>(this + 1); }
+
+    value_type data;
+    int height;
+    // The inserter and the list each hold one. The list lets go when the
+    // node is snipped out of level 0, the inserter once it is done with the
+    // upper levels, so a node erased while it is still being linked is not
+    // reclaimed under the inserter.
+    std::atomic<int> owners{2};
+  };
+
+  struct Retired {
+    Node *node;
+    uint64_t epoch;
+  };
+
+  static constexpr size_type kReclaimBatch = 64;
+
+  static Node *Pointer(uintptr_t link) {
+    return reinterpret_cast<Node *>(link & ~kMark);
+  }
+  static uintptr_t Address(Node *node) {
+    return reinterpret_cast<uintptr_t>(node);
+  }
+  static Link *Mutable(const Link *link) { return const_cast<Link *>(link); }
+
+  static Node *FirstLive(Node *node) {
+    while (node && (node->links()[0].load() & kMark)) {
+      node = Pointer(node->links()[0].load());
+    }
+    return node;
+  }
+
+  static Node *Create(const key_type &key, const mapped_type &obj,
+                      int height) {
+    void *raw = ::operator new(sizeof(Node) + height * sizeof(Link));
+    Node *node = new (raw) Node(key, obj, height);
+    for (int level = 0; level < height; ++level) {
+      new (&node->links()[level]) Link(0);
+    }
+    return node;
+  }
+
+  static void Destroy(Node *node) {
+    node->~Node();
+    ::operator delete(node);
+  }
+
+  // Geometric with p = 1/2, from a per-thread xorshift generator.
+  static int RandomHeight() {
+    thread_local uint64_t state =
+        0x9E3779B97F4A7C15ULL ^ reinterpret_cast<uintptr_t>(&state);
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    int height = 1;
+    for (uint64_t bits = state; (bits & 1) && height < kMaxHeight;
+         bits >>= 1) {
+      ++height;
+    }
+    return height;
+  }
+
+  void RaiseHeight(int height) {
+    int current = height_.load();
+    while (current < height &&
+           !height_.compare_exchange_weak(current, height)) {
+    }
+  }
+
+  // The lookups behind find() and lower_bound(), for callers already
+  // holding a ReadGuard. Read-only: they step over marked nodes instead of
+  // snipping them.
+  Node *LowerBound(const key_type &key) const {
+    const Link *pred = head_;
+    Node *curr = nullptr;
+    for (int level = height_.load() - 1; level >= 0; --level) {
+      curr = Pointer(pred[level].load());
+      while (curr) {
+        uintptr_t next = curr->links()[level].load();
+        if (!(next & kMark) && !compare_(curr->data.first, key)) break;
+        if (!(next & kMark)) pred = curr->links();
+        curr = Pointer(next);
+      }
+    }
+    return curr;
+  }
+
+  Node *FindNode(const key_type &key) const {
+    Node *node = LowerBound(key);
+    if (node && compare_(key, node->data.first)) return nullptr;
+    return node;
+  }
+
+  // Fills preds and succs with the neighbours key would have on every
+  // level, unlinking the marked nodes it passes. Returns whether succs[0]
+  // holds key.
+  bool Find(const key_type &key, const Link **preds, Node **succs) {
+  retry:
+    const Link *pred = head_;
+    for (int level = kMaxHeight - 1; level >= 0; --level) {
+      Node *curr = Pointer(pred[level].load());
+      while (curr) {
+        uintptr_t next = curr->links()[level].load();
+        if (next & kMark) {
+          uintptr_t expected = Address(curr);
+          if (!Mutable(&pred[level])
+                   ->compare_exchange_strong(expected, next & ~kMark)) {
+            goto retry;
+          }
+          if (level == 0) Release(curr);
+          curr = Pointer(next);
+          continue;
+        }
+        if (!compare_(curr->data.first, key)) break;
+        pred = curr->links();
+        curr = Pointer(next);
+      }
+      preds[level] = pred + level;
+      succs[level] = curr;
+    }
+    return succs[0] && !compare_(key, succs[0]->data.first);
+  }
+
+  // Links node into levels 1 and up after it is already live at level 0.
+  // Gives up when the node gets erased meanwhile, making sure the eraser's
+  // unlink is not undone by a link made after it.
+  void LinkUpperLevels(Node *node, const key_type &key, int height,
+                       const Link **preds, Node **succs) {
+    Link *links = node->links();
+    for (int level = 1; level < height; ++level) {
+      while (true) {
+        uintptr_t current = links[level].load();
+        if (current & kMark) break;
+        if (Pointer(current) != succs[level] &&
+            !links[level].compare_exchange_strong(current,
+                                                  Address(succs[level]))) {
+          continue;
+        }
+        uintptr_t expected = Address(succs[level]);
+        if (Mutable(preds[level])
+                ->compare_exchange_strong(expected, Address(node))) {
+          break;
+        }
+        Find(key, preds, succs);
+        if (succs[0] != node) break;
+      }
+      if (links[level].load() & kMark) break;
+    }
+    if (links[0].load() & kMark) Find(key, preds, succs);
+    Release(node);
+  }
+
+  // Drops one of the two owners; the last one retires the node.
+  void Release(Node *node) {
+    if (node->owners.fetch_sub(1) != 1) return;
+    std::lock_guard<std::mutex> lock(retired_mutex_);
+    retired_.push_back({node, epoch::Domain::Global().Retire()});
+    if (retired_.size() < kReclaimBatch) return;
+    size_type kept = 0;
+    for (const Retired &old : retired_) {
+      if (epoch::Domain::Global().Expired(old.epoch)) {
+        Destroy(old.node);
+      } else {
+        retired_[kept++] = old;
+      }
+    }
+    retired_.resize(kept);
+  }
+
+  Link head_[kMaxHeight];
+  std::atomic<int> height_{1};
+  std::atomic<size_type> count_{0};
+  Compare compare_;
+  std::mutex retired_mutex_;
+  std::vector<Retired> retired_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_CONCURRENT_SKIP_LIST_MAP_H_
@@ -2,5 +2,7 @@
 #define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_H_
 
 #include "s21_array.h"
+#include "s21_multimap.h"
+#include "s21_multiset.h"
 
 #endif  // S21_CONTAINERS_S21_CONTAINERSPLUS_H_
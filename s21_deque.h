@@ -0,0 +1,321 @@
+#ifndef S21_CONTAINERS_SRC_S21_DEQUE_H_
+#define S21_CONTAINERS_SRC_S21_DEQUE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Double-ended queue over a map of fixed-size blocks. Element i lives at
+// slot start_ + i of the concatenated blocks, so indexing is a shift and a
+// mask. Growing either end allocates at most one block and, rarely, a
+// bigger map of block pointers; elements themselves are never moved, so
+// references stay valid across push_front/push_back.
+template <typename T>
+class Deque {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  // elements per block: a power of two filling about 512 bytes, at least 16
+  static constexpr size_type kBlockSize = [] {
+    size_type n = 16;
+    while (n * 2 * sizeof(T) <= 512) n *= 2;
+    return n;
+  }();
+
+  template <bool IsConst>
+  class DequeIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const T*, T*>;
+    using reference = std::conditional_t<IsConst, const T&, T&>;
+    using owner_pointer =
+        std::conditional_t<IsConst, const Deque*, Deque*>;
+
+    DequeIterator() : deque(nullptr), index(0) {}
+    DequeIterator(owner_pointer owner, size_type i) : deque(owner), index(i) {}
+    // iterator converts to const_iterator, not the other way round
+    template <bool C = IsConst, typename = std::enable_if_t<C>>
+    DequeIterator(const DequeIterator<false>& other)
+        : deque(other.deque), index(other.index) {}
+
+    reference operator*() const noexcept { return deque->slot(index); }
+    pointer operator->() const noexcept { return &deque->slot(index); }
+    reference operator[](difference_type n) const noexcept {
+      return deque->slot(index + n);
+    }
+
+    DequeIterator& operator++() noexcept {
+      ++index;
+      return *this;
+    }
+    DequeIterator& operator--() noexcept {
+      --index;
+      return *this;
+    }
+    DequeIterator operator++(int) noexcept { return {deque, index++}; }
+    DequeIterator operator--(int) noexcept { return {deque, index--}; }
+    DequeIterator& operator+=(difference_type n) noexcept {
+      index += n;
+      return *this;
+    }
+    DequeIterator& operator-=(difference_type n) noexcept {
+      index -= n;
+      return *this;
+    }
+    DequeIterator operator+(difference_type n) const noexcept {
+      return {deque, index + n};
+    }
+    DequeIterator operator-(difference_type n) const noexcept {
+      return {deque, index - n};
+    }
+    difference_type operator-(const DequeIterator& other) const noexcept {
+      return static_cast<difference_type>(index - other.index);
+    }
+
+    bool operator==(const DequeIterator& other) const noexcept {
+      return index == other.index;
+    }
+    bool operator!=(const DequeIterator& other) const noexcept {
+      return index != other.index;
+    }
+    bool operator<(const DequeIterator& other) const noexcept {
+      return index < other.index;
+    }
+    bool operator>(const DequeIterator& other) const noexcept {
+      return index > other.index;
+    }
+    bool operator<=(const DequeIterator& other) const noexcept {
+      return index <= other.index;
+    }
+    bool operator>=(const DequeIterator& other) const noexcept {
+      return index >= other.index;
+    }
+
+   private:
+    owner_pointer deque;
+    size_type index;
+    friend class Deque;
+    friend class DequeIterator<true>;
+  };
+
+  using iterator = DequeIterator<false>;
+  using const_iterator = DequeIterator<true>;
+
+  Deque() : map_(nullptr), map_size_(0), start_(0), size_(0) {}
+
+  explicit Deque(size_type n) : Deque() {
+    for (size_type i = 0; i < n; ++i) push_back(value_type());
+  }
+
+  Deque(std::initializer_list<value_type> const& items) : Deque() {
+    for (const_reference item : items) push_back(item);
+  }
+
+  Deque(const Deque& other) : Deque() {
+    for (size_type i = 0; i < other.size_; ++i) push_back(other[i]);
+  }
+
+  Deque(Deque&& other) noexcept : Deque() { swap(other); }
+
+  ~Deque() {
+    clear();
+    MapStorage::Deallocate(map_, map_size_);
+  }
+
+  Deque& operator=(const Deque& other) {
+    if (this != &other) {
+      Deque copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  Deque& operator=(Deque&& other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("Out of range");
+    return slot(pos);
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Out of range");
+    return slot(pos);
+  }
+
+  reference operator[](size_type pos) noexcept { return slot(pos); }
+  const_reference operator[](size_type pos) const noexcept {
+    return slot(pos);
+  }
+
+  reference front() noexcept { return slot(0); }
+  const_reference front() const noexcept { return slot(0); }
+  reference back() noexcept { return slot(size_ - 1); }
+  const_reference back() const noexcept { return slot(size_ - 1); }
+
+  iterator begin() noexcept { return iterator(this, 0); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  iterator end() noexcept { return iterator(this, size_); }
+  const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+
+  // Destroys every element and frees the blocks; the map is kept.
+  void clear() noexcept {
+    while (size_) pop_back();
+  }
+
+  void push_back(const_reference value) {
+    if (start_ + size_ == map_size_ * kBlockSize) GrowMap();
+    size_type pos = start_ + size_;
+    bool fresh = size_ == 0 || pos % kBlockSize == 0;
+    if (fresh) map_[pos / kBlockSize] = BlockStorage::Allocate(kBlockSize);
+    try {
+      new (&raw(pos)) value_type(value);
+    } catch (...) {
+      if (fresh) FreeBlock(pos);
+      throw;
+    }
+    ++size_;
+  }
+
+  void push_front(const_reference value) {
+    if (start_ == 0) GrowMap();
+    size_type pos = start_ - 1;
+    bool fresh = size_ == 0 || start_ % kBlockSize == 0;
+    if (fresh) map_[pos / kBlockSize] = BlockStorage::Allocate(kBlockSize);
+    try {
+      new (&raw(pos)) value_type(value);
+    } catch (...) {
+      if (fresh) FreeBlock(pos);
+      throw;
+    }
+    start_ = pos;
+    ++size_;
+  }
+
+  void pop_back() noexcept {
+    size_type pos = start_ + --size_;
+    raw(pos).~value_type();
+    if (size_ == 0 || pos % kBlockSize == 0) FreeBlock(pos);
+    if (size_ == 0) Recenter();
+  }
+
+  void pop_front() noexcept {
+    size_type pos = start_++;
+    raw(pos).~value_type();
+    --size_;
+    if (size_ == 0 || start_ % kBlockSize == 0) FreeBlock(pos);
+    if (size_ == 0) Recenter();
+  }
+
+  void swap(Deque& other) noexcept {
+    std::swap(map_, other.map_);
+    std::swap(map_size_, other.map_size_);
+    std::swap(start_, other.start_);
+    std::swap(size_, other.size_);
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args&&... args) {
+    for (auto value : {std::forward<Args>(args)...}) {
+      push_back(value);
+    }
+  }
+
+  // Inserts the arguments in order before the first element.
+  template <typename... Args>
+  void insert_many_front(Args&&... args) {
+    std::initializer_list<value_type> items = {std::forward<Args>(args)...};
+    for (auto it = items.end(); it != items.begin();) push_front(*--it);
+  }
+
+ private:
+  using BlockStorage = HeapStorage<value_type>;
+  using MapStorage = HeapStorage<value_type*>;
+
+  reference raw(size_type pos) const noexcept {
+    return map_[pos / kBlockSize][pos % kBlockSize];
+  }
+
+  reference slot(size_type i) const noexcept { return raw(start_ + i); }
+
+  void FreeBlock(size_type pos) noexcept {
+    BlockStorage::Deallocate(map_[pos / kBlockSize], kBlockSize);
+    map_[pos / kBlockSize] = nullptr;
+  }
+
+  // An empty deque restarts from the middle of its map so that either end
+  // has room to grow.
+  void Recenter() noexcept { start_ = map_size_ / 2 * kBlockSize; }
+
+  // Makes room for one more block at whichever end is full. Only the block
+  // pointers move: in place when the map is at most half used, otherwise
+  // into a map twice as large.
+  void GrowMap() {
+    if (size_ == 0) {
+      if (map_size_ == 0) {
+        map_ = MapStorage::Allocate(8);
+        std::fill(map_, map_ + 8, nullptr);
+        map_size_ = 8;
+      }
+      Recenter();
+      return;
+    }
+    size_type first = start_ / kBlockSize;
+    size_type used = (start_ + size_ - 1) / kBlockSize - first + 1;
+    size_type new_size = used * 2 <= map_size_ ? map_size_ : map_size_ * 2;
+    size_type offset = (new_size - used) / 2;
+    value_type** map = map_;
+    if (new_size != map_size_) {
+      map = MapStorage::Allocate(new_size);
+      std::fill(map, map + new_size, nullptr);
+      std::copy(map_ + first, map_ + first + used, map + offset);
+      MapStorage::Deallocate(map_, map_size_);
+    } else if (offset < first) {
+      std::copy(map_ + first, map_ + first + used, map_ + offset);
+      std::fill(map_ + std::max(offset + used, first), map_ + first + used,
+                nullptr);
+    } else {
+      std::copy_backward(map_ + first, map_ + first + used,
+                         map_ + offset + used);
+      std::fill(map_ + first, map_ + std::min(first + used, offset),
+                nullptr);
+    }
+    map_ = map;
+    map_size_ = new_size;
+    start_ = offset * kBlockSize + start_ % kBlockSize;
+  }
+
+  value_type** map_;
+  size_type map_size_;
+  size_type start_;
+  size_type size_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_DEQUE_H_
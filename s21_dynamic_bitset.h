@@ -0,0 +1,244 @@
+#ifndef S21_CONTAINERS_SRC_S21_DYNAMIC_BITSET_H_
+#define S21_CONTAINERS_SRC_S21_DYNAMIC_BITSET_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace s21 {
+
+// Bit array sized at run time, packed into 64-bit words. count() is a
+// popcount per word, find_first/next/prev jump over zero words and locate
+// the bit with ctz/clz, and the set operations work a word at a time.
+//
+// Bits past size() are always zero. The binary operators accept operands
+// of different sizes, the missing bits counting as zero: |= and ^= grow
+// *this to the larger size, &= and -= keep its size.
+class dynamic_bitset {
+ public:
+  using size_type = size_t;
+  using word_type = uint64_t;
+
+  static constexpr size_type npos = ~size_type(0);
+  static constexpr size_type kWordBits = 64;
+
+  dynamic_bitset() = default;
+
+  // bits zeros.
+  explicit dynamic_bitset(size_type bits)
+      : words_(WordsFor(bits)), size_(bits) {}
+
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  // New bits are zero.
+  void resize(size_type bits) {
+    words_.resize(WordsFor(bits));
+    size_ = bits;
+    ClearTail();
+  }
+
+  void clear() noexcept {
+    words_.clear();
+    size_ = 0;
+  }
+
+  void swap(dynamic_bitset &other) noexcept {
+    words_.swap(other.words_);
+    std::swap(size_, other.size_);
+  }
+
+  // Unchecked.
+  bool operator[](size_type pos) const {
+    return words_[pos / kWordBits] >> (pos % kWordBits) & 1;
+  }
+
+  // These throw std::out_of_range when pos >= size().
+  bool test(size_type pos) const {
+    Check(pos);
+    return (*this)[pos];
+  }
+
+  dynamic_bitset &set(size_type pos, bool value = true) {
+    Check(pos);
+    word_type bit = Bit(pos);
+    word_type &word = words_[pos / kWordBits];
+    word = value ? word | bit : word & ~bit;
+    return *this;
+  }
+
+  dynamic_bitset &reset(size_type pos) { return set(pos, false); }
+
+  dynamic_bitset &flip(size_type pos) {
+    Check(pos);
+    words_[pos / kWordBits] ^= Bit(pos);
+    return *this;
+  }
+
+  // All bits at once.
+  dynamic_bitset &set() {
+    std::fill(words_.begin(), words_.end(), ~word_type(0));
+    ClearTail();
+    return *this;
+  }
+
+  dynamic_bitset &reset() {
+    std::fill(words_.begin(), words_.end(), word_type(0));
+    return *this;
+  }
+
+  dynamic_bitset &flip() {
+    for (word_type &word : words_) word = ~word;
+    ClearTail();
+    return *this;
+  }
+
+  size_type count() const noexcept {
+    size_type total = 0;
+    for (word_type word : words_) total += __builtin_popcountll(word);
+    return total;
+  }
+
+  bool any() const noexcept {
+    return std::any_of(words_.begin(), words_.end(),
+                       [](word_type word) { return word != 0; });
+  }
+  bool none() const noexcept { return !any(); }
+  bool all() const noexcept { return count() == size_; }
+
+  // Position of the first set bit, or npos.
+  size_type find_first() const noexcept { return FindFrom(0); }
+
+  // The first set bit after pos, or npos; pos may be anything.
+  size_type find_next(size_type pos) const noexcept {
+    return pos >= size_ ? npos : FindFrom(pos + 1);
+  }
+
+  // The last set bit, or npos.
+  size_type find_last() const noexcept { return FindBefore(size_); }
+
+  // The last set bit before pos, or npos; pos may be anything.
+  size_type find_prev(size_type pos) const noexcept {
+    return FindBefore(std::min(pos, size_));
+  }
+
+  dynamic_bitset &operator|=(const dynamic_bitset &other) {
+    if (other.size_ > size_) resize(other.size_);
+    for (size_type i = 0; i < other.words_.size(); ++i) {
+      words_[i] |= other.words_[i];
+    }
+    return *this;
+  }
+
+  dynamic_bitset &operator^=(const dynamic_bitset &other) {
+    if (other.size_ > size_) resize(other.size_);
+    for (size_type i = 0; i < other.words_.size(); ++i) {
+      words_[i] ^= other.words_[i];
+    }
+    return *this;
+  }
+
+  dynamic_bitset &operator&=(const dynamic_bitset &other) noexcept {
+    size_type common = std::min(words_.size(), other.words_.size());
+    for (size_type i = 0; i < common; ++i) words_[i] &= other.words_[i];
+    std::fill(words_.begin() + common, words_.end(), word_type(0));
+    return *this;
+  }
+
+  // Clears the bits set in other.
+  dynamic_bitset &operator-=(const dynamic_bitset &other) noexcept {
+    size_type common = std::min(words_.size(), other.words_.size());
+    for (size_type i = 0; i < common; ++i) words_[i] &= ~other.words_[i];
+    return *this;
+  }
+
+  friend dynamic_bitset operator|(dynamic_bitset a, const dynamic_bitset &b) {
+    return a |= b;
+  }
+  friend dynamic_bitset operator&(dynamic_bitset a, const dynamic_bitset &b) {
+    return a &= b;
+  }
+  friend dynamic_bitset operator^(dynamic_bitset a, const dynamic_bitset &b) {
+    return a ^= b;
+  }
+  friend dynamic_bitset operator-(dynamic_bitset a, const dynamic_bitset &b) {
+    return a -= b;
+  }
+
+  // Same size and same bits.
+  bool operator==(const dynamic_bitset &other) const {
+    return size_ == other.size_ && words_ == other.words_;
+  }
+  bool operator!=(const dynamic_bitset &other) const {
+    return !(*this == other);
+  }
+
+  // Whether every bit set here is set in other too.
+  bool is_subset_of(const dynamic_bitset &other) const noexcept {
+    for (size_type i = 0; i < words_.size(); ++i) {
+      word_type theirs = i < other.words_.size() ? other.words_[i] : 0;
+      if (words_[i] & ~theirs) return false;
+    }
+    return true;
+  }
+
+  bool intersects(const dynamic_bitset &other) const noexcept {
+    size_type common = std::min(words_.size(), other.words_.size());
+    for (size_type i = 0; i < common; ++i) {
+      if (words_[i] & other.words_[i]) return true;
+    }
+    return false;
+  }
+
+ private:
+  static size_type WordsFor(size_type bits) {
+    return bits / kWordBits + (bits % kWordBits != 0);
+  }
+
+  static word_type Bit(size_type pos) {
+    return word_type(1) << (pos % kWordBits);
+  }
+
+  void Check(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Bit position out of range");
+  }
+
+  void ClearTail() {
+    if (size_ % kWordBits) words_.back() &= Bit(size_) - 1;
+  }
+
+  // The first set bit at or after pos, which is at most size_.
+  size_type FindFrom(size_type pos) const noexcept {
+    size_type i = pos / kWordBits;
+    if (i >= words_.size()) return npos;
+    word_type word = words_[i] & (~word_type(0) << (pos % kWordBits));
+    while (!word) {
+      if (++i == words_.size()) return npos;
+      word = words_[i];
+    }
+    return i * kWordBits + __builtin_ctzll(word);
+  }
+
+  // The last set bit before pos, which is at most size_.
+  size_type FindBefore(size_type pos) const noexcept {
+    if (pos == 0) return npos;
+    size_type last = pos - 1;
+    size_type i = last / kWordBits;
+    word_type word =
+        words_[i] & (~word_type(0) >> (kWordBits - 1 - last % kWordBits));
+    while (!word) {
+      if (i-- == 0) return npos;
+      word = words_[i];
+    }
+    return i * kWordBits + kWordBits - 1 - __builtin_clzll(word);
+  }
+
+  std::vector<word_type> words_;
+  size_type size_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_DYNAMIC_BITSET_H_
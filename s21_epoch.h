@@ -0,0 +1,114 @@
+#ifndef S21_CONTAINERS_SRC_S21_EPOCH_H_
+#define S21_CONTAINERS_SRC_S21_EPOCH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace s21 {
+namespace epoch {
+
+// Epoch-based reclamation shared by the concurrent containers. A reader
+// announces the epoch it started in for as long as it holds a ReadGuard; a
+// writer that unlinks an object tags it with the epoch current at the
+// unlink (Retire()) and frees it once no announced epoch is that old
+// (Expired()). Readers never write shared state beyond their own slot, so
+// lookups do not contend with each other or with the writer.
+//
+// Slots are per thread and shared by every container, claimed on a
+// thread's first read and released when it exits. Guards nest.
+class Domain {
+ public:
+  static constexpr size_t kMaxThreads = 256;
+
+  static Domain &Global() {
+    static Domain domain;
+    return domain;
+  }
+
+  Domain(const Domain &) = delete;
+  Domain &operator=(const Domain &) = delete;
+
+  // Call after the object has been unpublished; pass the result to
+  // Expired() to learn when it can be freed.
+  uint64_t Retire() {
+    return epoch_.fetch_add(1, std::memory_order_seq_cst);
+  }
+
+  // Whether every reader that might still see an object retired at epoch
+  // has finished.
+  bool Expired(uint64_t epoch) const {
+    for (const Slot &slot : slots_) {
+      uint64_t seen = slot.epoch.load(std::memory_order_seq_cst);
+      if (seen != 0 && seen <= epoch) return false;
+    }
+    return true;
+  }
+
+ private:
+  friend class ReadGuard;
+
+  struct alignas(64) Slot {
+    std::atomic<uint64_t> epoch{0};  // 0 while the thread is not reading
+    std::atomic<bool> taken{false};
+  };
+
+  // The calling thread's slot and guard depth, released at thread exit.
+  struct Local {
+    ~Local() {
+      if (slot) slot->taken.store(false, std::memory_order_release);
+    }
+    Slot *slot = nullptr;
+    unsigned depth = 0;
+  };
+
+  Domain() = default;
+
+  Local &ThreadLocal() {
+    thread_local Local local;
+    if (!local.slot) {
+      for (Slot &slot : slots_) {
+        if (!slot.taken.exchange(true, std::memory_order_acquire)) {
+          local.slot = &slot;
+          break;
+        }
+      }
+      if (!local.slot) throw std::length_error("Too many reader threads");
+    }
+    return local;
+  }
+
+  std::atomic<uint64_t> epoch_{1};
+  Slot slots_[kMaxThreads];
+};
+
+// Protects whatever the thread reads from published pointers until the
+// guard is destroyed.
+class ReadGuard {
+ public:
+  explicit ReadGuard(Domain &domain = Domain::Global())
+      : local_(domain.ThreadLocal()) {
+    if (local_.depth++ == 0) {
+      local_.slot->epoch.store(domain.epoch_.load(std::memory_order_seq_cst),
+                               std::memory_order_seq_cst);
+    }
+  }
+
+  ReadGuard(const ReadGuard &) = delete;
+  ReadGuard &operator=(const ReadGuard &) = delete;
+
+  ~ReadGuard() {
+    if (--local_.depth == 0) {
+      local_.slot->epoch.store(0, std::memory_order_release);
+    }
+  }
+
+ private:
+  Domain::Local &local_;
+};
+
+}  // namespace epoch
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_EPOCH_H_
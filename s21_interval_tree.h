@@ -0,0 +1,292 @@
+#ifndef S21_CONTAINERS_SRC_S21_INTERVAL_TREE_H_
+#define S21_CONTAINERS_SRC_S21_INTERVAL_TREE_H_
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+#include "trees/s21_intrusive_tree.h"
+
+namespace s21 {
+
+// Half-open intervals [low, high) with a value each, on the same red-black
+// engine as set. Nodes are ordered by (low, high), equal intervals in
+// insertion order, and every node also caches the largest high in its
+// subtree. A query skips any subtree whose cached high cannot reach it and
+// stops going right at the first node starting past it, so it walks the
+// O(log n) boundary paths plus the subtrees holding its matches.
+//
+// The visitors get value_type& and may return false to stop the walk;
+// they must not insert or erase. Iterators stay valid until their own
+// element is erased.
+template <typename K, typename V>
+class IntervalTree {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using size_type = size_t;
+
+  struct value_type {
+    const K low;
+    const K high;
+    V value;
+  };
+
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+ private:
+  struct Node : RbHook {
+    Node(const K &low, const K &high, const V &value)
+        : entry{low, high, value}, max(high) {}
+    value_type entry;
+    K max;
+  };
+
+ public:
+  template <bool IsConst>
+  class IntervalIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = IntervalTree::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const value_type *,
+                                       value_type *>;
+    using reference = std::conditional_t<IsConst, const value_type &,
+                                         value_type &>;
+
+    IntervalIterator() : node_(nullptr), tree_(nullptr) {}
+    IntervalIterator(RbHook *node, const IntervalTree *tree)
+        : node_(node), tree_(tree) {}
+    template <bool C = IsConst, typename = std::enable_if_t<C>>
+    IntervalIterator(const IntervalIterator<false> &other)
+        : node_(other.node_), tree_(other.tree_) {}
+
+    reference operator*() const { return AsNode(node_)->entry; }
+    pointer operator->() const { return &AsNode(node_)->entry; }
+
+    IntervalIterator &operator++() {
+      node_ = RbTree::Next(node_);
+      return *this;
+    }
+
+    // --end() is the last interval
+    IntervalIterator &operator--() {
+      node_ = node_ ? RbTree::Previous(node_)
+                    : RbTree::MaxFromHere(tree_->root_);
+      return *this;
+    }
+
+    bool operator==(const IntervalIterator &other) const {
+      return node_ == other.node_;
+    }
+    bool operator!=(const IntervalIterator &other) const {
+      return node_ != other.node_;
+    }
+
+   private:
+    RbHook *node_;
+    const IntervalTree *tree_;
+    friend class IntervalTree;
+    friend class IntervalIterator<true>;
+  };
+
+  using iterator = IntervalIterator<false>;
+  using const_iterator = IntervalIterator<true>;
+
+  IntervalTree() = default;
+  IntervalTree(const IntervalTree &) = delete;
+  IntervalTree &operator=(const IntervalTree &) = delete;
+
+  IntervalTree(IntervalTree &&other) noexcept { swap(other); }
+
+  IntervalTree &operator=(IntervalTree &&other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~IntervalTree() { clear(); }
+
+  iterator begin() { return iterator(First(), this); }
+  iterator end() { return iterator(nullptr, this); }
+  const_iterator begin() const { return const_iterator(First(), this); }
+  const_iterator end() const { return const_iterator(nullptr, this); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+
+  // Frees every node in O(n) without rebalancing.
+  void clear() noexcept {
+    RbHook *node = root_;
+    while (node) {
+      if (node->leftChild) {
+        node = node->leftChild;
+      } else if (node->rightChild) {
+        node = node->rightChild;
+      } else {
+        RbHook *parent = node->parent;
+        if (parent) {
+          if (parent->leftChild == node) {
+            parent->leftChild = nullptr;
+          } else {
+            parent->rightChild = nullptr;
+          }
+        }
+        delete AsNode(node);
+        node = parent;
+      }
+    }
+    root_ = nullptr;
+    size_ = 0;
+  }
+
+  void swap(IntervalTree &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+  }
+
+  // Throws std::invalid_argument unless low < high.
+  iterator insert(const K &low, const K &high, const V &value) {
+    if (!(low < high)) {
+      throw std::invalid_argument("IntervalTree: low must be below high");
+    }
+    RbHook *parent = nullptr;
+    RbHook *node = root_;
+    bool left = true;
+    while (node) {
+      parent = node;
+      const value_type &at = AsNode(node)->entry;
+      left = low < at.low || (!(at.low < low) && high < at.high);
+      node = left ? node->leftChild : node->rightChild;
+    }
+    Node *added = new Node(low, high, value);
+    RbTree::Link(root_, parent, left, added, UpdateMax());
+    ++size_;
+    return iterator(added, this);
+  }
+
+  // Returns the iterator following pos.
+  iterator erase(iterator pos) {
+    RbHook *next = RbTree::Next(pos.node_);
+    RbTree::Erase(root_, pos.node_, UpdateMax());
+    delete AsNode(pos.node_);
+    --size_;
+    return iterator(next, this);
+  }
+
+  // The first interval equal to [low, high), or end().
+  iterator find(const K &low, const K &high) {
+    RbHook *candidate = nullptr;
+    RbHook *node = root_;
+    while (node) {
+      const value_type &at = AsNode(node)->entry;
+      if (at.low < low || (!(low < at.low) && at.high < high)) {
+        node = node->rightChild;
+      } else {
+        candidate = node;
+        node = node->leftChild;
+      }
+    }
+    if (candidate) {
+      const value_type &at = AsNode(candidate)->entry;
+      if (low < at.low || high < at.high) candidate = nullptr;
+    }
+    return iterator(candidate, this);
+  }
+
+  // Calls visit on every interval overlapping [low, high), in order, and
+  // returns how many were visited.
+  template <typename Visitor>
+  size_type visit_overlapping(const K &low, const K &high, Visitor visit) {
+    size_type visited = 0;
+    auto starts_in_time = [&high](const K &start) { return start < high; };
+    Walk(root_, low, starts_in_time, visit, visited);
+    return visited;
+  }
+
+  // Calls visit on every interval containing point, in order, and returns
+  // how many were visited.
+  template <typename Visitor>
+  size_type visit_containing(const K &point, Visitor visit) {
+    size_type visited = 0;
+    auto starts_in_time = [&point](const K &start) { return !(point < start); };
+    Walk(root_, point, starts_in_time, visit, visited);
+    return visited;
+  }
+
+  // Same as above, collecting copies of the matches instead.
+  s21::Vector<value_type> overlapping(const K &low, const K &high) {
+    s21::Vector<value_type> found;
+    visit_overlapping(low, high,
+                      [&found](value_type &entry) { found.push_back(entry); });
+    return found;
+  }
+
+  s21::Vector<value_type> containing(const K &point) {
+    s21::Vector<value_type> found;
+    visit_containing(point,
+                     [&found](value_type &entry) { found.push_back(entry); });
+    return found;
+  }
+
+  // Whether anything overlaps [low, high); stops at the first match.
+  bool overlaps(const K &low, const K &high) {
+    return visit_overlapping(low, high, [](value_type &) { return false; });
+  }
+
+ private:
+  static Node *AsNode(RbHook *hook) { return static_cast<Node *>(hook); }
+
+  struct UpdateMax {
+    void operator()(RbHook *hook) const {
+      Node *node = AsNode(hook);
+      node->max = node->entry.high;
+      for (RbHook *child : {hook->leftChild, hook->rightChild}) {
+        if (child && node->max < AsNode(child)->max) {
+          node->max = AsNode(child)->max;
+        }
+      }
+    }
+  };
+
+  RbHook *First() const {
+    return root_ ? RbTree::MinFromHere(root_) : nullptr;
+  }
+
+  // In-order walk of the intervals ending after from and starting early
+  // enough for starts_in_time. Returns false once visit asks to stop.
+  template <typename StartsInTime, typename Visitor>
+  static bool Walk(RbHook *hook, const K &from, StartsInTime &starts_in_time,
+                   Visitor &visit, size_type &visited) {
+    if (!hook) return true;
+    Node *node = AsNode(hook);
+    if (!(from < node->max)) return true;
+    if (!Walk(hook->leftChild, from, starts_in_time, visit, visited)) {
+      return false;
+    }
+    // everything from here rightwards starts no earlier than node
+    if (!starts_in_time(node->entry.low)) return true;
+    if (from < node->entry.high) {
+      ++visited;
+      if constexpr (std::is_same_v<decltype(visit(node->entry)), bool>) {
+        if (!visit(node->entry)) return false;
+      } else {
+        visit(node->entry);
+      }
+    }
+    return Walk(hook->rightChild, from, starts_in_time, visit, visited);
+  }
+
+  RbHook *root_ = nullptr;
+  size_type size_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_INTERVAL_TREE_H_
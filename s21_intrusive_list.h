@@ -0,0 +1,168 @@
+#ifndef S21_CONTAINERS_SRC_S21_INTRUSIVE_LIST_H_
+#define S21_CONTAINERS_SRC_S21_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+
+namespace s21 {
+
+// Links embedded in an element so that IntrusiveList can chain it without
+// allocating. An element may sit in as many lists as it has hooks.
+struct ListHook {
+  ListHook* next = nullptr;
+  ListHook* prev = nullptr;
+
+  bool is_linked() const noexcept { return next != nullptr; }
+};
+
+namespace detail {
+
+// Byte offset of the Hook member inside T. Under the Itanium C++ ABI that
+// GCC and Clang follow, a pointer to data member holds exactly that offset,
+// so this folds to a constant with no object involved. The one member whose
+// offset isn't fixed, one inside a virtual base, can't be named as H T::*.
+template <typename T, typename H, H T::*Hook>
+std::ptrdiff_t HookOffset() noexcept {
+  static_assert(sizeof(H T::*) == sizeof(std::ptrdiff_t),
+                "pointer to member is not a plain offset");
+  H T::*member = Hook;
+  std::ptrdiff_t offset;
+  std::memcpy(&offset, &member, sizeof(offset));
+  return offset;
+}
+
+template <typename T, typename H, H T::*Hook>
+T* HookOwner(H* hook) noexcept {
+  return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) -
+                              HookOffset<T, H, Hook>());
+}
+
+}  // namespace detail
+
+// Doubly linked list over caller-owned objects:
+//   struct Job { int id; s21::ListHook hook; };
+//   s21::IntrusiveList<Job, &Job::hook> queue;
+// push/insert/erase never allocate or copy, remove(element) is O(1), and the
+// list never destroys its elements. An element must stay alive, and must not
+// join another list through the same hook, while it is linked.
+template <typename T, ListHook T::*Hook>
+class IntrusiveList {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  class IntrusiveListIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    IntrusiveListIterator() : ptr(nullptr) {}
+    explicit IntrusiveListIterator(ListHook* hook) : ptr(hook) {}
+
+    reference operator*() const noexcept { return *owner(ptr); }
+    pointer operator->() const noexcept { return owner(ptr); }
+
+    IntrusiveListIterator& operator++() noexcept {
+      ptr = ptr->next;
+      return *this;
+    }
+
+    IntrusiveListIterator& operator--() noexcept {
+      ptr = ptr->prev;
+      return *this;
+    }
+
+    bool operator==(const IntrusiveListIterator& other) const noexcept {
+      return ptr == other.ptr;
+    }
+
+    bool operator!=(const IntrusiveListIterator& other) const noexcept {
+      return ptr != other.ptr;
+    }
+
+   private:
+    ListHook* ptr;
+    friend class IntrusiveList;
+  };
+
+  using iterator = IntrusiveListIterator;
+
+  IntrusiveList() noexcept { end_.next = end_.prev = &end_; }
+  IntrusiveList(const IntrusiveList&) = delete;
+  IntrusiveList& operator=(const IntrusiveList&) = delete;
+  ~IntrusiveList() { clear(); }
+
+  reference front() noexcept { return *owner(end_.next); }
+  reference back() noexcept { return *owner(end_.prev); }
+
+  iterator begin() noexcept { return iterator(end_.next); }
+  iterator end() noexcept { return iterator(&end_); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+
+  // Unlinks every element; the elements themselves are left alone.
+  void clear() noexcept {
+    ListHook* hook = end_.next;
+    while (hook != &end_) {
+      ListHook* next = hook->next;
+      hook->next = hook->prev = nullptr;
+      hook = next;
+    }
+    end_.next = end_.prev = &end_;
+    size_ = 0;
+  }
+
+  iterator insert(iterator pos, reference value) noexcept {
+    ListHook* hook = &(value.*Hook);
+    hook->next = pos.ptr;
+    hook->prev = pos.ptr->prev;
+    pos.ptr->prev->next = hook;
+    pos.ptr->prev = hook;
+    ++size_;
+    return iterator(hook);
+  }
+
+  iterator erase(iterator pos) noexcept {
+    iterator next(pos.ptr->next);
+    remove(*pos);
+    return next;
+  }
+
+  // Unlinks value, which must be in this list, without searching for it.
+  void remove(reference value) noexcept {
+    ListHook* hook = &(value.*Hook);
+    hook->prev->next = hook->next;
+    hook->next->prev = hook->prev;
+    hook->next = hook->prev = nullptr;
+    --size_;
+  }
+
+  void push_back(reference value) noexcept { insert(end(), value); }
+  void push_front(reference value) noexcept { insert(begin(), value); }
+  void pop_back() noexcept { remove(back()); }
+  void pop_front() noexcept { remove(front()); }
+
+  // Iterator to an element already linked into this list.
+  iterator iterator_to(reference value) noexcept {
+    return iterator(&(value.*Hook));
+  }
+
+ private:
+  static T* owner(ListHook* hook) noexcept {
+    return detail::HookOwner<T, ListHook, Hook>(hook);
+  }
+
+  ListHook end_;
+  size_type size_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_INTRUSIVE_LIST_H_
@@ -0,0 +1,197 @@
+#ifndef S21_CONTAINERS_SRC_S21_INTRUSIVE_SET_H_
+#define S21_CONTAINERS_SRC_S21_INTRUSIVE_SET_H_
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "s21_intrusive_list.h"
+#include "trees/s21_intrusive_tree.h"
+
+namespace s21 {
+
+// Ordered set of unique, caller-owned objects linked through an embedded
+// RbHook:
+//   struct Timer { long deadline; s21::RbHook hook; };
+//   s21::IntrusiveSet<Timer, &Timer::hook, ByDeadline> timers;
+// Insertion never allocates or copies, and remove(element) unlinks straight
+// from the hook with no search. The set never destroys its elements; they
+// must outlive their membership and keep their key unchanged while linked.
+template <typename T, RbHook T::*Hook, typename Compare = std::less<T>>
+class IntrusiveSet {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  class IntrusiveSetIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    IntrusiveSetIterator() : ptr(nullptr), set(nullptr) {}
+    IntrusiveSetIterator(RbHook* hook, const IntrusiveSet* owner)
+        : ptr(hook), set(owner) {}
+
+    reference operator*() const noexcept { return *IntrusiveSet::owner(ptr); }
+    pointer operator->() const noexcept { return IntrusiveSet::owner(ptr); }
+
+    IntrusiveSetIterator& operator++() noexcept {
+      ptr = RbTree::Next(ptr);
+      return *this;
+    }
+
+    // --end() is the largest element
+    IntrusiveSetIterator& operator--() noexcept {
+      ptr = ptr ? RbTree::Previous(ptr) : RbTree::MaxFromHere(set->root_);
+      return *this;
+    }
+
+    bool operator==(const IntrusiveSetIterator& other) const noexcept {
+      return ptr == other.ptr;
+    }
+
+    bool operator!=(const IntrusiveSetIterator& other) const noexcept {
+      return ptr != other.ptr;
+    }
+
+   private:
+    RbHook* ptr;
+    const IntrusiveSet* set;
+    friend class IntrusiveSet;
+  };
+
+  using iterator = IntrusiveSetIterator;
+
+  IntrusiveSet() = default;
+  explicit IntrusiveSet(const Compare& comp) : comp_(comp) {}
+  IntrusiveSet(const IntrusiveSet&) = delete;
+  IntrusiveSet& operator=(const IntrusiveSet&) = delete;
+  ~IntrusiveSet() { clear(); }
+
+  iterator begin() noexcept {
+    return iterator(root_ ? RbTree::MinFromHere(root_) : nullptr, this);
+  }
+  iterator end() noexcept { return iterator(nullptr, this); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+
+  // Unlinks every element in O(n) without rebalancing.
+  void clear() noexcept {
+    RbHook* node = root_;
+    while (node) {
+      if (node->leftChild) {
+        node = node->leftChild;
+      } else if (node->rightChild) {
+        node = node->rightChild;
+      } else {
+        RbHook* parent = node->parent;
+        if (parent) {
+          if (parent->leftChild == node) {
+            parent->leftChild = nullptr;
+          } else {
+            parent->rightChild = nullptr;
+          }
+        }
+        node->parent = nullptr;
+        node->isBlack = false;
+        node = parent;
+      }
+    }
+    root_ = nullptr;
+    size_ = 0;
+  }
+
+  // Links value unless an equivalent element is already present, in which
+  // case that element is returned and value is left untouched.
+  std::pair<iterator, bool> insert(reference value) {
+    RbHook* parent = nullptr;
+    RbHook* node = root_;
+    bool left = true;
+    while (node) {
+      parent = node;
+      if (comp_(value, *owner(node))) {
+        left = true;
+        node = node->leftChild;
+      } else if (comp_(*owner(node), value)) {
+        left = false;
+        node = node->rightChild;
+      } else {
+        return {iterator(node, this), false};
+      }
+    }
+    RbHook* hook = &(value.*Hook);
+    RbTree::Link(root_, parent, left, hook);
+    ++size_;
+    return {iterator(hook, this), true};
+  }
+
+  iterator erase(iterator pos) noexcept {
+    iterator next(RbTree::Next(pos.ptr), this);
+    remove(*pos);
+    return next;
+  }
+
+  // Removes the element equivalent to key, if any; returns how many went.
+  size_type erase(const_reference key) {
+    iterator it = find(key);
+    if (it == end()) return 0;
+    erase(it);
+    return 1;
+  }
+
+  // Unlinks value, which must be in this set, without searching for it.
+  void remove(reference value) noexcept {
+    RbTree::Erase(root_, &(value.*Hook));
+    --size_;
+  }
+
+  iterator find(const_reference key) {
+    iterator it = lower_bound(key);
+    if (it != end() && comp_(key, *it)) return end();
+    return it;
+  }
+
+  bool contains(const_reference key) { return find(key) != end(); }
+
+  // First element not less than key.
+  iterator lower_bound(const_reference key) {
+    RbHook* candidate = nullptr;
+    RbHook* node = root_;
+    while (node) {
+      if (comp_(*owner(node), key)) {
+        node = node->rightChild;
+      } else {
+        candidate = node;
+        node = node->leftChild;
+      }
+    }
+    return iterator(candidate, this);
+  }
+
+  // Iterator to an element already linked into this set.
+  iterator iterator_to(reference value) noexcept {
+    return iterator(&(value.*Hook), this);
+  }
+
+ private:
+  static T* owner(RbHook* hook) noexcept {
+    return detail::HookOwner<T, RbHook, Hook>(hook);
+  }
+
+  RbHook* root_ = nullptr;
+  size_type size_ = 0;
+  Compare comp_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_INTRUSIVE_SET_H_
@@ -6,6 +6,8 @@
 #include <limits>
 #include <utility>
 
+#include "s21_serialization.h"
+
 namespace s21 {
 
 template <typename T>
@@ -16,19 +18,25 @@ class List {
   using const_reference = const T&;
   using size_type = size_t;
 
-  struct Node {
-    Node* next;
-    Node* prev;
+  // Links only; the list's sentinel is a bare NodeBase, so it never holds
+  // (or needs to construct) a value_type.
+  struct NodeBase {
+    NodeBase* next;
+    NodeBase* prev;
+  };
+
+  struct Node : NodeBase {
     value_type value;
     Node(const_reference other_value)
-        : next(nullptr), prev(nullptr), value(other_value) {}
+        : NodeBase{nullptr, nullptr}, value(other_value) {}
   };
 
   class ListConstIterator {
    public:
     ListConstIterator() : ptr(nullptr) {}
     ListConstIterator(const ListConstIterator& other) : ptr(other.ptr) {}
-    explicit ListConstIterator(const Node* other) : ptr(other) {}
+    explicit ListConstIterator(const NodeBase* other)
+        : ptr(const_cast<NodeBase*>(other)) {}
     const_reference operator*() const noexcept;
     ListConstIterator& operator++() noexcept;
     ListConstIterator& operator--() noexcept;
@@ -36,7 +44,7 @@ class List {
     bool operator!=(const ListConstIterator& other) const noexcept;
 
    private:
-    Node* ptr;
+    NodeBase* ptr;
     friend class List;
   };
 
@@ -44,7 +52,7 @@ class List {
    public:
     ListIterator();
     ListIterator(const ListIterator& other) : ListConstIterator(other) {}
-    explicit ListIterator(Node* other);
+    explicit ListIterator(NodeBase* other);
     reference operator*() noexcept;
     ListIterator& operator=(const ListIterator& other);
   };
@@ -82,6 +90,9 @@ class List {
   void swap(List& other) noexcept;
   void merge(List& other);
   void splice(const_iterator pos, List& other) noexcept;
+  void splice(const_iterator pos, List& other, const_iterator it) noexcept;
+  void splice(const_iterator pos, List& other, const_iterator first,
+              const_iterator last) noexcept;
   void reverse() noexcept;
   void unique();
   void sort();
@@ -93,17 +104,31 @@ class List {
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args&&... args);
 
+  void serialize(std::ostream& os) const;
+  size_type serialize(char* buffer, size_type size) const;
+  size_type serialized_size() const;
+  void deserialize(std::istream& is);
+  size_type deserialize(const char* buffer, size_type size);
+
   // вспомогательные методы
   bool operator==(const List& other) const noexcept;
   bool operator!=(const List& other) const noexcept;
 
  private:
-  Node* head_;
-  Node* tail_;
-  Node* end_;
+  // Circular sentinel: end_.next is the first node and end_.prev the last,
+  // both pointing back at end_ while the list is empty.
+  NodeBase end_;
   size_type size_;
 
-  void set_end();
+  static void link(NodeBase* pos, NodeBase* node) noexcept;
+  static void unlink(NodeBase* node) noexcept;
+  static void transfer(NodeBase* pos, NodeBase* first,
+                       NodeBase* last) noexcept;
+  void reset() noexcept;
+  template <typename Writer>
+  void Save(Writer& writer) const;
+  template <typename Reader>
+  void Load(Reader& reader);
 };
 
 template <typename value_type>
@@ -137,13 +162,13 @@ List<value_type>::iterator::ListIterator() {
 }
 
 template <typename value_type>
-List<value_type>::iterator::ListIterator(Node* other) {
+List<value_type>::iterator::ListIterator(NodeBase* other) {
   this->ptr = other;
 }
 
 template <typename value_type>
 List<value_type>& List<value_type>::operator=(const List& l) {
-  if (*this != l) {
+  if (this != &l) {
     clear();
     for (iterator it = l.begin(); it != l.end(); ++it) {
       push_back(*it);
@@ -154,7 +179,7 @@ List<value_type>& List<value_type>::operator=(const List& l) {
 
 template <typename value_type>
 List<value_type>& List<value_type>::operator=(List&& l) noexcept {
-  if (*this != l) {
+  if (this != &l) {
     clear();
     swap(l);
   }
@@ -164,7 +189,7 @@ List<value_type>& List<value_type>::operator=(List&& l) noexcept {
 template <typename value_type>
 typename List<value_type>::reference
 List<value_type>::ListIterator::operator*() noexcept {
-  return this->ptr->value;
+  return static_cast<Node*>(this->ptr)->value;
 }
 
 template <typename value_type>
@@ -177,7 +202,7 @@ List<value_type>::ListIterator::operator=(const ListIterator& other) {
 template <typename value_type>
 typename List<value_type>::const_reference
 List<value_type>::ListConstIterator::operator*() const noexcept {
-  return this->ptr->value;
+  return static_cast<const Node*>(this->ptr)->value;
 }
 
 template <typename value_type>
@@ -207,84 +232,96 @@ bool List<value_type>::const_iterator::operator!=(
 }
 
 template <typename value_type>
-List<value_type>::List()
-    : head_(nullptr), tail_(nullptr), end_(nullptr), size_(0) {
-  end_ = new Node(0);
-  set_end();
-}
-
-template <typename value_type>
-void List<value_type>::set_end() {
-  end_->next = head_;
-  end_->prev = tail_;
-  end_->value = size_;
-  if (head_) head_->prev = end_;
-  if (tail_) tail_->next = end_;
-}
+List<value_type>::List() : end_{&end_, &end_}, size_(0) {}
 
 template <typename value_type>
-List<value_type>::List(size_type n)
-    : head_(nullptr), tail_(nullptr), end_(nullptr), size_(0) {
+List<value_type>::List(size_type n) : end_{&end_, &end_}, size_(0) {
   if (n > max_size()) throw std::invalid_argument("incorrect size");
-  end_ = new Node(size_);
   for (size_type i = 0; i < n; ++i) {
     push_back(value_type());
   }
-  set_end();
 }
 
 template <typename value_type>
 List<value_type>::List(std::initializer_list<value_type> const& items)
-    : head_(nullptr), tail_(nullptr), end_(nullptr), size_(0) {
-  end_ = new Node(size_);
+    : end_{&end_, &end_}, size_(0) {
   for (auto it = items.begin(); it != items.end(); ++it) {
     push_back(*it);
   }
-  set_end();
 }
 
 template <typename value_type>
-List<value_type>::List(const List& l)
-    : head_(nullptr), tail_(nullptr), end_(nullptr), size_(0) {
-  end_ = new Node(size_);
+List<value_type>::List(const List& l) : end_{&end_, &end_}, size_(0) {
   for (iterator it = l.begin(); it != l.end(); ++it) {
     push_back(*it);
   }
-  set_end();
 }
 
 template <typename value_type>
-List<value_type>::List(List&& l) noexcept
-    : head_(nullptr), tail_(nullptr), end_(nullptr), size_(0) {
+List<value_type>::List(List&& l) noexcept : end_{&end_, &end_}, size_(0) {
   swap(l);
 }
 
 template <typename value_type>
 List<value_type>::~List() {
   clear();
-  if (end_) delete end_;
+}
+
+template <typename value_type>
+void List<value_type>::link(NodeBase* pos, NodeBase* node) noexcept {
+  node->next = pos;
+  node->prev = pos->prev;
+  pos->prev->next = node;
+  pos->prev = node;
+}
+
+template <typename value_type>
+void List<value_type>::unlink(NodeBase* node) noexcept {
+  node->prev->next = node->next;
+  node->next->prev = node->prev;
+}
+
+// Relinks [first, last) in front of pos; pos must not lie inside the range.
+template <typename value_type>
+void List<value_type>::transfer(NodeBase* pos, NodeBase* first,
+                                NodeBase* last) noexcept {
+  if (first == last || pos == first || pos == last) return;
+  NodeBase* tail = last->prev;
+  first->prev->next = last;
+  last->prev = first->prev;
+  first->prev = pos->prev;
+  tail->next = pos;
+  pos->prev->next = first;
+  pos->prev = tail;
+}
+
+template <typename value_type>
+void List<value_type>::reset() noexcept {
+  end_.next = &end_;
+  end_.prev = &end_;
+  size_ = 0;
 }
 
 template <typename value_type>
 typename List<value_type>::const_reference List<value_type>::front()
     const noexcept {
-  return head_ ? head_->value : end_->value;
+  return static_cast<const Node*>(end_.next)->value;
 }
 
 template <typename value_type>
 typename List<value_type>::const_reference List<value_type>::back()
     const noexcept {
-  return tail_ ? tail_->value : end_->value;
+  return static_cast<const Node*>(end_.prev)->value;
 }
 
 template <typename value_type>
 typename List<value_type>::iterator List<value_type>::begin() const noexcept {
-  return head_ ? iterator(head_) : iterator(end_);
+  return iterator(end_.next);
 }
 
 template <typename value_type>
 typename List<value_type>::iterator List<value_type>::end() const noexcept {
-  return iterator(end_);
+  return iterator(const_cast<NodeBase*>(&end_));
 }
 
 template <typename value_type>
@@ -305,119 +342,67 @@ typename List<value_type>::size_type List<value_type>::max_size()
 
 template <typename value_type>
 void List<value_type>::clear() noexcept {
-  while (!empty()) {
-    pop_back();
+  NodeBase* node = end_.next;
+  while (node != &end_) {
+    NodeBase* next = node->next;
+    delete static_cast<Node*>(node);
+    node = next;
   }
+  reset();
 }
 
 template <typename value_type>
 typename List<value_type>::iterator List<value_type>::insert(
     iterator pos, const_reference value) {
-  iterator it = end();
-  if (pos == begin()) {
-    push_front(value);
-    it = begin();
-  } else if (pos == end()) {
-    push_back(value);
-    --it;
-  } else {
-    Node* temp = new Node(value);
-    temp->next = pos.ptr;
-    temp->prev = pos.ptr->prev;
-    pos.ptr->prev = temp;
-    temp->prev->next = temp;
-    ++size_;
-    set_end();
-    it = iterator(temp);
-  }
-  return it;
+  Node* temp = new Node(value);
+  link(pos.ptr, temp);
+  ++size_;
+  return iterator(temp);
 }
 
 template <typename value_type>
 void List<value_type>::erase(iterator pos) noexcept {
-  if (!empty() && pos != end()) {
-    if (pos == begin()) {
-      pop_front();
-    } else if (pos.ptr == end_->prev) {
-      pop_back();
-    } else {
-      pos.ptr->prev->next = pos.ptr->next;
-      pos.ptr->next->prev = pos.ptr->prev;
-      delete pos.ptr;
-      --size_;
-      set_end();
-    }
+  if (pos.ptr != &end_) {
+    unlink(pos.ptr);
+    delete static_cast<Node*>(pos.ptr);
+    --size_;
   }
 }
 
 template <typename value_type>
 void List<value_type>::push_back(const_reference value) {
-  Node* temp = new Node(value);
-  if (empty()) {
-    head_ = temp;
-    tail_ = temp;
-  } else {
-    tail_->next = temp;
-    temp->prev = tail_;
-    tail_ = temp;
-  }
-  ++size_;
-  set_end();
+  insert(end(), value);
 }
 
 template <typename value_type>
 void List<value_type>::push_front(const_reference value) {
-  Node* temp = new Node(value);
-  if (empty()) {
-    head_ = temp;
-    tail_ = temp;
-  } else {
-    temp->next = head_;
-    head_->prev = temp;
-    head_ = temp;
-  }
-  ++size_;
-  set_end();
+  insert(begin(), value);
 }
 
 template <typename value_type>
 void List<value_type>::pop_back() noexcept {
-  if (!empty()) {
-    Node* temp = tail_;
-    if (size() > 1) {
-      tail_ = tail_->prev;
-    } else {
-      head_ = nullptr;
-      tail_ = nullptr;
-    }
-    delete temp;
-    --size_;
-    set_end();
-  }
+  erase(iterator(end_.prev));
 }
 
 template <typename value_type>
 void List<value_type>::pop_front() noexcept {
-  if (!empty()) {
-    Node* temp = head_;
-    if (size() > 1) {
-      head_ = head_->next;
-    } else {
-      head_ = nullptr;
-      tail_ = nullptr;
-    }
-    delete temp;
-    --size_;
-    set_end();
-  }
+  erase(iterator(end_.next));
 }
 
 template <typename value_type>
 void List<value_type>::swap(List& other) noexcept {
-  std::swap(head_, other.head_);
-  std::swap(tail_, other.tail_);
+  std::swap(end_.next, other.end_.next);
+  std::swap(end_.prev, other.end_.prev);
   std::swap(size_, other.size_);
-  std::swap(end_, other.end_);
+  // re-anchor both chains on their new sentinel
+  for (List* list : {this, &other}) {
+    if (list->size_ == 0) {
+      list->reset();
+    } else {
+      list->end_.next->prev = &list->end_;
+      list->end_.prev->next = &list->end_;
+    }
+  }
 }
 
 template <typename value_type>
@@ -425,16 +410,17 @@ void List<value_type>::merge(List& other) {
   if (this != &other) {
     iterator it = begin();
     iterator it_other = other.begin();
-    while (!other.empty()) {
-      if (*it_other < *it || it == end()) {
-        insert(it, *it_other);
-        iterator temp = it_other;
+    while (it_other != other.end()) {
+      if (it == end() || *it_other < *it) {
+        NodeBase* node = it_other.ptr;
         ++it_other;
-        other.erase(temp);
+        transfer(it.ptr, node, it_other.ptr);
       } else {
         ++it;
       }
     }
+    size_ += other.size_;
+    other.size_ = 0;
   }
 }
 
@@ -462,50 +448,54 @@ bool List<value_type>::operator!=(const List& other) const noexcept {
 
 template <typename value_type>
 void List<value_type>::reverse() noexcept {
-  if (size() > 1) {
-    iterator it_beg = begin();
-    iterator it_end = end();
-    --it_end;
-    for (size_type i = 0; i < size() / 2; i++) {
-      std::swap(it_beg.ptr->value, it_end.ptr->value);
-      ++it_beg;
-      --it_end;
-    }
-  }
+  NodeBase* node = &end_;
+  do {
+    std::swap(node->next, node->prev);
+    node = node->prev;
+  } while (node != &end_);
 }
 
 template <typename value_type>
 void List<value_type>::splice(const_iterator pos, List& other) noexcept {
-  if (!other.empty()) {
-    if (head_) {
-      other.head_->prev = pos.ptr->prev;
-      pos.ptr->prev->next = other.head_;
-      if (pos == begin()) head_ = other.head_;
-      if (pos == end()) tail_ = other.tail_;
-    } else {
-      other.head_->prev = pos.ptr;
-      pos.ptr->next = other.head_;
-      head_ = other.head_;
-      tail_ = other.tail_;
-    }
-    other.tail_->next = pos.ptr;
-    pos.ptr->prev = other.tail_;
-    other.head_ = nullptr;
-    other.tail_ = nullptr;
+  if (this != &other) {
+    transfer(pos.ptr, other.end_.next, &other.end_);
     size_ += other.size_;
     other.size_ = 0;
-    set_end();
-    other.set_end();
   }
 }
 
+template <typename value_type>
+void List<value_type>::splice(const_iterator pos, List& other,
+                              const_iterator it) noexcept {
+  transfer(pos.ptr, it.ptr, it.ptr->next);
+  if (this != &other) {
+    ++size_;
+    --other.size_;
+  }
+}
+
+// O(1) within one list; between lists the range is walked once to keep
+// both sizes right.
+template <typename value_type>
+void List<value_type>::splice(const_iterator pos, List& other,
+                              const_iterator first,
+                              const_iterator last) noexcept {
+  if (this != &other) {
+    size_type count = 0;
+    for (const_iterator it = first; it != last; ++it) ++count;
+    size_ += count;
+    other.size_ -= count;
+  }
+  transfer(pos.ptr, first.ptr, last.ptr);
+}
+
 template <typename value_type>
 void List<value_type>::unique() {
   if (size() > 1) {
     iterator it = begin();
     ++it;
     while (it != end()) {
-      value_type temp = it.ptr->prev->value;
+      const_reference temp = static_cast<Node*>(it.ptr->prev)->value;
       iterator for_erase = it;
       ++it;
       if (temp == *for_erase) {
@@ -522,12 +512,70 @@ void List<value_type>::sort() {
       iterator it_begin = begin();
       ++it_begin;
       for (iterator it2 = it_begin; it2 != end(); ++it2) {
-        if (*it2 < it2.ptr->prev->value) std::swap(*it2, it2.ptr->prev->value);
+        reference prev = static_cast<Node*>(it2.ptr->prev)->value;
+        if (*it2 < prev) std::swap(*it2, prev);
       }
     }
   }
 }
 
+template <typename value_type>
+void List<value_type>::serialize(std::ostream& os) const {
+  serialization::StreamWriter writer(os);
+  Save(writer);
+}
+
+template <typename value_type>
+typename List<value_type>::size_type List<value_type>::serialize(
+    char* buffer, size_type size) const {
+  serialization::BufferWriter writer(buffer, size);
+  Save(writer);
+  return writer.count();
+}
+
+template <typename value_type>
+typename List<value_type>::size_type List<value_type>::serialized_size()
+    const {
+  serialization::SizeCounter writer;
+  Save(writer);
+  return writer.count();
+}
+
+template <typename value_type>
+void List<value_type>::deserialize(std::istream& is) {
+  serialization::StreamReader reader(is);
+  Load(reader);
+}
+
+template <typename value_type>
+typename List<value_type>::size_type List<value_type>::deserialize(
+    const char* buffer, size_type size) {
+  serialization::BufferReader reader(buffer, size);
+  Load(reader);
+  return reader.count();
+}
+
+template <typename value_type>
+template <typename Writer>
+void List<value_type>::Save(Writer& writer) const {
+  serialization::WriteHeader(writer, size_);
+  for (iterator it = begin(); it != end(); ++it) {
+    serialization::WriteValue(writer, *it);
+  }
+}
+
+template <typename value_type>
+template <typename Reader>
+void List<value_type>::Load(Reader& reader) {
+  uint64_t n = serialization::ReadHeader<value_type>(reader);
+  clear();
+  for (uint64_t i = 0; i < n; ++i) {
+    value_type value;
+    serialization::ReadValue(reader, value);
+    push_back(value);
+  }
+}
+
 }  // namespace s21
 
 #endif  //  S21_CONTAINERS_SRC_S21_LIST_H_
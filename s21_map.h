@@ -5,16 +5,19 @@
 
 namespace s21 {
 
-template <typename Key, typename T>
-class map : public BinaryTree<Key, T> {
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class map : public BinaryTree<Key, T, Compare> {
  public:
   using key_type = Key;
   using mapped_type = T;
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type &;
   using size_type = size_t;
+  using key_compare = Compare;
 
-  explicit map() noexcept : BinaryTree<Key, T>() {}
+  explicit map() noexcept : BinaryTree<Key, T, Compare>() {}
+
+  explicit map(const Compare &comp) : BinaryTree<Key, T, Compare>(comp) {}
 
   map(std::initializer_list<value_type> const &items) noexcept {
     for (const auto &item : items) {
@@ -22,11 +25,13 @@ class map : public BinaryTree<Key, T> {
     }
   }
 
-  explicit map(const map &other) noexcept : BinaryTree<Key, T>() {
+  explicit map(const map &other) noexcept
+      : BinaryTree<Key, T, Compare>(other.compare) {
     this->copyUnique(other.root);
   }
 
-  explicit map(map &&other) noexcept : BinaryTree<Key, T>() {
+  explicit map(map &&other) noexcept
+      : BinaryTree<Key, T, Compare>(other.compare) {
     std::swap(this->root, other.root);
     std::swap(this->treeSize, other.treeSize);
   }
@@ -36,15 +41,19 @@ class map : public BinaryTree<Key, T> {
   map &operator=(map &&other) noexcept {
     std::swap(this->root, other.root);
     std::swap(this->treeSize, other.treeSize);
+    std::swap(this->compare, other.compare);
     return *this;
   }
 
   void swap(map &other) noexcept {
     std::swap(this->root, other.root);
     std::swap(this->treeSize, other.treeSize);
+    std::swap(this->compare, other.compare);
   }
 
-  void merge(map &other) noexcept { this->copyUnique(other.root); }
+  // Moves the entries of other whose keys are missing here by relinking
+  // their nodes; entries with keys already present stay in other.
+  void merge(map &other) noexcept { BinaryTree<Key, T, Compare>::merge(other); }
 
  private:
 };
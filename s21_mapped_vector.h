@@ -0,0 +1,193 @@
+#ifndef S21_CONTAINERS_SRC_S21_MAPPED_VECTOR_H_
+#define S21_CONTAINERS_SRC_S21_MAPPED_VECTOR_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Read API of Vector over a file mapping. The file starts with a fixed
+// 64-byte header followed by the raw elements, so opening it costs one
+// mmap() no matter how large the table is. Files are produced by Write().
+//
+// kReadOnly maps the file copy-on-write: writes through the non-const
+// accessors land in private pages and never reach the file. kReadWrite
+// shares the pages with the file; sync() flushes them.
+template <class T>
+class MappedVector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "MappedVector needs a trivially copyable element type");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  static constexpr uint32_t kVersion = 1;
+
+  enum class Mode { kReadOnly, kReadWrite };
+
+  struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t element_size;
+    uint32_t element_align;
+    uint64_t size;
+    char reserved[40];
+  };
+  static_assert(sizeof(Header) == 64, "header layout changed");
+
+  MappedVector() : fd_(-1), mode_(Mode::kReadOnly), bytes_(0), base_(nullptr) {}
+
+  explicit MappedVector(const std::string &path, Mode mode = Mode::kReadOnly)
+      : MappedVector() {
+    mode_ = mode;
+    fd_ = open(path.c_str(), mode == Mode::kReadOnly ? O_RDONLY : O_RDWR);
+    if (fd_ < 0) throw std::runtime_error("Cannot open " + path);
+    struct stat st;
+    if (fstat(fd_, &st) != 0 || size_t(st.st_size) < sizeof(Header)) {
+      close(fd_);
+      throw std::runtime_error("Not a mapped vector: " + path);
+    }
+    bytes_ = size_t(st.st_size);
+    int flags = mode == Mode::kReadWrite ? MAP_SHARED : MAP_PRIVATE;
+    void *p = mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, flags, fd_, 0);
+    if (p == MAP_FAILED) {
+      close(fd_);
+      throw std::runtime_error("Cannot map " + path);
+    }
+    base_ = static_cast<char *>(p);
+    const char *error = Validate();
+    if (error) {
+      Release();
+      throw std::runtime_error(error + (": " + path));
+    }
+  }
+
+  MappedVector(const MappedVector &) = delete;
+  MappedVector &operator=(const MappedVector &) = delete;
+
+  MappedVector(MappedVector &&v) noexcept : MappedVector() { swap(v); }
+
+  MappedVector &operator=(MappedVector &&v) noexcept {
+    if (this != &v) {
+      Release();
+      swap(v);
+    }
+    return *this;
+  }
+
+  ~MappedVector() { Release(); }
+
+  // Writes n elements in the mapped format, replacing the file.
+  static void Write(const std::string &path, const T *data, size_type n) {
+    Header header{};
+    std::memcpy(header.magic, "S21V", 4);
+    header.version = kVersion;
+    header.element_size = sizeof(T);
+    header.element_align = alignof(T);
+    header.size = n;
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(data), n * sizeof(T));
+    if (!out) throw std::runtime_error("Cannot write " + path);
+  }
+
+  template <class Storage>
+  static void Write(const std::string &path, Vector<T, Storage> &v) {
+    Write(path, v.data(), v.size());
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size()) throw std::out_of_range("Out of range");
+    return data()[pos];
+  }
+
+  reference operator[](size_type pos) { return data()[pos]; }
+
+  const_reference operator[](size_type pos) const { return data()[pos]; }
+
+  const_reference front() const { return data()[0]; }
+
+  const_reference back() const { return data()[size() - 1]; }
+
+  iterator data() { return reinterpret_cast<T *>(base_ + sizeof(Header)); }
+
+  const_iterator data() const {
+    return reinterpret_cast<const T *>(base_ + sizeof(Header));
+  }
+
+  iterator begin() { return data(); }
+
+  iterator end() { return data() + size(); }
+
+  const_iterator begin() const { return data(); }
+
+  const_iterator end() const { return data() + size(); }
+
+  bool empty() const { return size() == 0; }
+
+  size_type size() const {
+    return base_ ? reinterpret_cast<const Header *>(base_)->size : 0;
+  }
+
+  bool is_open() const { return base_ != nullptr; }
+
+  // Flushes changes made through a read-write mapping back to the file.
+  void sync() {
+    if (base_ && mode_ == Mode::kReadWrite && msync(base_, bytes_, MS_SYNC))
+      throw std::runtime_error("msync failed");
+  }
+
+  void swap(MappedVector &other) noexcept {
+    std::swap(fd_, other.fd_);
+    std::swap(mode_, other.mode_);
+    std::swap(bytes_, other.bytes_);
+    std::swap(base_, other.base_);
+  }
+
+ private:
+  const char *Validate() const {
+    const Header *header = reinterpret_cast<const Header *>(base_);
+    if (std::memcmp(header->magic, "S21V", 4) != 0) return "Bad magic";
+    if (header->version != kVersion) return "Unsupported version";
+    if (header->element_size != sizeof(T) ||
+        header->element_align != alignof(T))
+      return "Element type mismatch";
+    if (header->size > (bytes_ - sizeof(Header)) / sizeof(T))
+      return "Truncated file";
+    return nullptr;
+  }
+
+  void Release() {
+    if (base_) munmap(base_, bytes_);
+    if (fd_ >= 0) close(fd_);
+    base_ = nullptr;
+    fd_ = -1;
+    bytes_ = 0;
+  }
+
+  int fd_;
+  Mode mode_;
+  size_t bytes_;
+  char *base_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_MAPPED_VECTOR_H_
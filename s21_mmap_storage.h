@@ -0,0 +1,85 @@
+#ifndef S21_CONTAINERS_SRC_S21_MMAP_STORAGE_H_
+#define S21_CONTAINERS_SRC_S21_MMAP_STORAGE_H_
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <new>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Vector storage backed by anonymous mappings instead of operator new:
+//   s21::Vector<double, s21::MmapStorage<double>> v;
+// Pages are committed by the kernel on first touch, and on Linux growth goes
+// through mremap(), which moves page tables instead of copying elements.
+// Buffers of at least kHugePage bytes are aligned to it and marked for
+// transparent huge pages.
+template <class T>
+struct MmapStorage {
+  static constexpr size_t kHugePage = size_t(2) << 20;
+
+  static T *Allocate(size_t n) {
+    if (n == 0) return nullptr;
+    size_t bytes = Bytes(n);
+    if (bytes < kHugePage) return reinterpret_cast<T *>(Map(bytes));
+
+    // over-map by one huge page and trim both ends to get an aligned range
+    char *raw = static_cast<char *>(Map(bytes + kHugePage));
+    uintptr_t addr = reinterpret_cast<uintptr_t>(raw);
+    char *aligned = reinterpret_cast<char *>((addr + kHugePage - 1) &
+                                             ~(uintptr_t)(kHugePage - 1));
+    size_t head = aligned - raw;
+    if (head) munmap(raw, head);
+    if (kHugePage - head) munmap(aligned + bytes, kHugePage - head);
+    Advise(aligned, bytes);
+    return reinterpret_cast<T *>(aligned);
+  }
+
+  static void Deallocate(T *p, size_t n) {
+    if (p) munmap(p, Bytes(n));
+  }
+
+  static T *Reallocate(T *p, size_t old_n, size_t new_n) {
+    if (p == nullptr) return Allocate(new_n);
+#ifdef MREMAP_MAYMOVE
+    size_t old_bytes = Bytes(old_n), new_bytes = Bytes(new_n);
+    void *moved = mremap(p, old_bytes, new_bytes, MREMAP_MAYMOVE);
+    if (moved == MAP_FAILED) throw std::bad_alloc();
+    Advise(moved, new_bytes);
+    return reinterpret_cast<T *>(moved);
+#else
+    (void)old_n;
+    (void)new_n;
+    return nullptr;
+#endif
+  }
+
+ private:
+  static size_t Bytes(size_t n) {
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return (n * sizeof(T) + page - 1) / page * page;
+  }
+
+  static void *Map(size_t bytes) {
+    void *p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (p == MAP_FAILED) throw std::bad_alloc();
+    return p;
+  }
+
+  static void Advise(void *p, size_t bytes) {
+#ifdef MADV_HUGEPAGE
+    if (bytes >= kHugePage) madvise(p, bytes, MADV_HUGEPAGE);
+#else
+    (void)p;
+    (void)bytes;
+#endif
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_MMAP_STORAGE_H_
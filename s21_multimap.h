@@ -0,0 +1,245 @@
+#ifndef S21_CONTAINERS_SRC_S21_MULTIMAP_H_
+#define S21_CONTAINERS_SRC_S21_MULTIMAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "trees/s21_red_black_tree.h"
+
+namespace s21 {
+
+// Sorted map allowing equivalent keys, on the red-black engine of set.
+// Entries with equivalent keys stay in insertion order; count(),
+// equal_range() and erase(key) cover the whole run.
+//
+// The engine keeps key and value side by side rather than in a
+// std::pair, so dereferencing an iterator gives a pair of references
+// (reference below) instead of a value_type&. it->first and it->second
+// read and write as usual.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class multimap {
+  typedef RedBlackTree<Key, T, Compare> tree;
+  typedef typename tree::Node Node;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = std::pair<const key_type &, mapped_type &>;
+  using const_reference = std::pair<const key_type &, const mapped_type &>;
+  using size_type = size_t;
+  using key_compare = Compare;
+  using node_type = typename tree::NodeHandle;
+
+  template <bool IsConst>
+  class MultimapIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = multimap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<IsConst, multimap::const_reference,
+                                         multimap::reference>;
+
+    // operator-> hands out the pair of references by value
+    struct pointer {
+      reference ref;
+      const reference *operator->() const { return &ref; }
+    };
+
+    MultimapIterator() : node_(nullptr), tree_(nullptr) {}
+    MultimapIterator(Node *node, const tree *owner)
+        : node_(node), tree_(owner) {}
+    // iterator converts to const_iterator, not the other way round
+    template <bool C = IsConst, typename = std::enable_if_t<C>>
+    MultimapIterator(const MultimapIterator<false> &other)
+        : node_(other.node_), tree_(other.tree_) {}
+
+    reference operator*() const { return {node_->Key(), node_->Value()}; }
+    pointer operator->() const { return pointer{**this}; }
+
+    MultimapIterator &operator++() {
+      node_ = node_->Next();
+      return *this;
+    }
+    // --end() is the last entry
+    MultimapIterator &operator--() {
+      node_ = node_ ? node_->Previous() : tree_->Last();
+      return *this;
+    }
+    MultimapIterator operator++(int) {
+      MultimapIterator old = *this;
+      ++*this;
+      return old;
+    }
+    MultimapIterator operator--(int) {
+      MultimapIterator old = *this;
+      --*this;
+      return old;
+    }
+
+    bool operator==(const MultimapIterator &other) const {
+      return node_ == other.node_;
+    }
+    bool operator!=(const MultimapIterator &other) const {
+      return node_ != other.node_;
+    }
+
+   private:
+    Node *node_;
+    const tree *tree_;
+    friend class multimap;
+    friend class MultimapIterator<true>;
+  };
+
+  using iterator = MultimapIterator<false>;
+  using const_iterator = MultimapIterator<true>;
+
+  multimap() = default;
+
+  explicit multimap(const Compare &comp) : tree_(comp) {}
+
+  multimap(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) insert(item);
+  }
+
+  iterator begin() { return iterator(First(), &tree_); }
+  iterator end() { return iterator(nullptr, &tree_); }
+  const_iterator begin() const { return const_iterator(First(), &tree_); }
+  const_iterator end() const { return const_iterator(nullptr, &tree_); }
+
+  bool empty() { return !tree_.GetSize(); }
+  size_type size() { return tree_.GetSize(); }
+  size_type max_size() { return std::numeric_limits<size_type>::max(); }
+
+  void clear() { tree_.Clear(); }
+
+  // Always inserts, after any entries whose keys are equivalent to key.
+  iterator insert(const value_type &value) {
+    return insert(value.first, value.second);
+  }
+
+  iterator insert(const key_type &key, const mapped_type &obj) {
+    return iterator(tree_.AddNodeMulti(key, obj), &tree_);
+  }
+
+  iterator insert(node_type &&node) {
+    if (node.empty()) return end();
+    return iterator(tree_.InsertMulti(node), &tree_);
+  }
+
+  void erase(iterator pos) { extract(pos); }
+
+  // Removes every entry whose key is equivalent to key, in one split and
+  // join of the tree.
+  size_type erase(const key_type &key) { return tree_.DeleteAll(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type erase(const K &key) {
+    return tree_.DeleteAll(key);
+  }
+
+  node_type extract(iterator pos) {
+    if (pos.node_ == nullptr) return node_type();
+    return tree_.Extract(pos.node_);
+  }
+
+  // Takes out the first of the entries with keys equivalent to key.
+  node_type extract(const key_type &key) { return extract(find(key)); }
+
+  void swap(multimap &other) noexcept { tree_.swap(other.tree_); }
+
+  // Relinks every entry of other here, after the entries with equivalent
+  // keys, so nothing is copied and other ends up empty.
+  void merge(multimap &other) {
+    if (&other == this) return;
+    while (!other.empty()) insert(other.extract(other.begin()));
+  }
+
+  size_type count(const key_type &key) { return Count(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const K &key) {
+    return Count(key);
+  }
+
+  // The first of the entries with keys equivalent to key, or end().
+  iterator find(const key_type &key) {
+    return iterator(tree_.FindFirst(key), &tree_);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) {
+    return iterator(tree_.FindFirst(key), &tree_);
+  }
+
+  bool contains(const key_type &key) { return tree_.FindNode(key) != NULL; }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) {
+    return tree_.FindNode(key) != NULL;
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  iterator lower_bound(const key_type &key) {
+    return iterator(tree_.LowerBound(key), &tree_);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) {
+    return iterator(tree_.LowerBound(key), &tree_);
+  }
+
+  iterator upper_bound(const key_type &key) {
+    return iterator(tree_.UpperBound(key), &tree_);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key) {
+    return iterator(tree_.UpperBound(key), &tree_);
+  }
+
+  key_compare key_comp() const { return tree_.KeyComp(); }
+
+ private:
+  Node *First() const {
+    tree &t = const_cast<tree &>(tree_);
+    return t.GetSize() ? t.MinInTree() : nullptr;
+  }
+
+  template <typename K>
+  size_type Count(const K &key) {
+    size_type n = 0;
+    Node *last = tree_.UpperBound(key);
+    for (Node *node = tree_.FindFirst(key); node && node != last;
+         node = node->Next()) {
+      ++n;
+    }
+    return n;
+  }
+
+  tree tree_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_MULTIMAP_H_
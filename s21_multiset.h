@@ -0,0 +1,175 @@
+#ifndef S21_CONTAINERS_SRC_S21_MULTISET_H_
+#define S21_CONTAINERS_SRC_S21_MULTISET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+
+#include "trees/s21_red_black_tree.h"
+
+namespace s21 {
+
+// Sorted bag on the same red-black engine as set. Equivalent values are
+// all kept, in the order they were inserted, and count(), equal_range()
+// and erase(key) work on the whole run of them. With a transparent
+// Compare the lookups take any type it can compare, as in set.
+template <typename T, typename Compare = std::less<T>>
+class multiset {
+ public:
+  typedef RedBlackTree<T, T, Compare> tree;
+  typedef T key_type;
+  typedef T value_type;
+  typedef T &reference;
+  typedef const T &const_reference;
+  typedef Compare key_compare;
+  typedef typename tree::iterator iterator;
+  typedef typename tree::const_iterator const_iterator;
+  typedef size_t size_type;
+  typedef typename tree::NodeHandle node_type;
+
+  multiset() = default;
+
+  explicit multiset(const Compare &comp) : tree_(comp) {}
+
+  multiset(std::initializer_list<value_type> const &items) {
+    for (const_reference item : items) insert(item);
+  }
+
+  iterator begin() { return tree_.begin(); }
+  iterator end() { return tree_.end(); }
+  const_iterator begin() const { return tree_.begin(); }
+  const_iterator end() const { return tree_.end(); }
+
+  bool empty() { return !tree_.GetSize(); }
+  size_type size() { return tree_.GetSize(); }
+  size_type max_size() { return std::numeric_limits<size_type>::max(); }
+
+  void clear() { tree_.Clear(); }
+
+  // Always inserts, after any values equivalent to value.
+  iterator insert(const value_type &value) {
+    return iterator(tree_.AddNodeMulti(value, value), &tree_);
+  }
+
+  iterator insert(node_type &&node) {
+    return iterator(tree_.InsertMulti(node), &tree_);
+  }
+
+  template <typename... Args>
+  void insert_many(Args &&...args) {
+    for (const_reference value : {std::forward<Args>(args)...}) {
+      insert(value);
+    }
+  }
+
+  void erase(iterator pos) { tree_.Extract(pos.operator->()); }
+
+  // Removes every value equivalent to key in one split and join.
+  size_type erase(const key_type &key) { return tree_.DeleteAll(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type erase(const K &key) {
+    return tree_.DeleteAll(key);
+  }
+
+  node_type extract(iterator pos) {
+    if (pos == end()) return node_type();
+    return tree_.Extract(pos.operator->());
+  }
+
+  // Takes out the first of the values equivalent to key.
+  node_type extract(const key_type &key) {
+    return tree_.Extract(tree_.FindFirst(key));
+  }
+
+  void swap(multiset &other) noexcept { tree_.swap(other.tree_); }
+
+  // Relinks every node of other, each after the values here equivalent to
+  // it, so nothing is copied and other ends up empty.
+  void merge(multiset &other) {
+    if (&other == this) return;
+    while (!other.empty()) {
+      node_type node = other.tree_.Extract(other.tree_.MinInTree());
+      tree_.InsertMulti(node);
+    }
+  }
+
+  size_type count(const key_type &key) { return Count(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const K &key) {
+    return Count(key);
+  }
+
+  // The first of the values equivalent to key, or end().
+  iterator find(const key_type &key) {
+    return iterator(tree_.FindFirst(key), &tree_);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) {
+    return iterator(tree_.FindFirst(key), &tree_);
+  }
+
+  bool contains(const key_type &key) { return tree_.FindNode(key) != NULL; }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) {
+    return tree_.FindNode(key) != NULL;
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  iterator lower_bound(const key_type &key) {
+    return iterator(tree_.LowerBound(key), &tree_);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) {
+    return iterator(tree_.LowerBound(key), &tree_);
+  }
+
+  iterator upper_bound(const key_type &key) {
+    return iterator(tree_.UpperBound(key), &tree_);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key) {
+    return iterator(tree_.UpperBound(key), &tree_);
+  }
+
+  key_compare key_comp() const { return tree_.KeyComp(); }
+
+ private:
+  template <typename K>
+  size_type Count(const K &key) {
+    size_type n = 0;
+    auto *last = tree_.UpperBound(key);
+    for (auto *node = tree_.FindFirst(key); node && node != last;
+         node = node->Next()) {
+      ++n;
+    }
+    return n;
+  }
+
+  tree tree_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_MULTISET_H_
@@ -0,0 +1,250 @@
+#ifndef S21_CONTAINERS_SRC_S21_PARALLEL_H_
+#define S21_CONTAINERS_SRC_S21_PARALLEL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "s21_vector.h"
+
+namespace s21 {
+namespace parallel {
+
+// Fixed set of worker threads. Run() is fork-join: the calling thread works
+// on the tasks too and returns once every task is done, so it can be nested
+// without starving the pool.
+class ThreadPool {
+ public:
+  explicit ThreadPool(size_t threads) : stop_(false) {
+    for (size_t i = 1; i < threads; ++i) {
+      workers_.emplace_back([this] { Work(); });
+    }
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    ready_.notify_all();
+    for (auto &worker : workers_) worker.join();
+  }
+
+  // threads taking part in Run(), the caller included
+  size_t size() const { return workers_.size() + 1; }
+
+  // Calls fn(i) for every i in [0, tasks) and rethrows the first exception.
+  template <class F>
+  void Run(size_t tasks, F fn) {
+    if (tasks == 0) return;
+    auto batch = std::make_shared<Batch>(tasks);
+    auto body = [batch, &fn] {
+      for (size_t i; (i = batch->next++) < batch->tasks;) {
+        try {
+          fn(i);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(batch->mutex);
+          if (!batch->error) batch->error = std::current_exception();
+        }
+        if (++batch->done == batch->tasks) {
+          std::lock_guard<std::mutex> lock(batch->mutex);
+          batch->finished.notify_all();
+        }
+      }
+    };
+    size_t helpers = std::min(workers_.size(), tasks - 1);
+    if (helpers) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (size_t i = 0; i < helpers; ++i) jobs_.push(body);
+    }
+    ready_.notify_all();
+    body();
+    std::unique_lock<std::mutex> lock(batch->mutex);
+    batch->finished.wait(lock, [&] { return batch->done == batch->tasks; });
+    if (batch->error) std::rethrow_exception(batch->error);
+  }
+
+ private:
+  struct Batch {
+    explicit Batch(size_t count) : tasks(count), next(0), done(0) {}
+    const size_t tasks;
+    std::atomic<size_t> next;
+    std::atomic<size_t> done;
+    std::mutex mutex;
+    std::condition_variable finished;
+    std::exception_ptr error;
+  };
+
+  void Work() {
+    for (;;) {
+      std::function<void()> job;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+        if (stop_ && jobs_.empty()) return;
+        job = std::move(jobs_.front());
+        jobs_.pop();
+      }
+      job();
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::queue<std::function<void()>> jobs_;
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  bool stop_;
+};
+
+namespace detail {
+
+// Built on first use by whichever thread gets there first; the static's
+// initialization is thread-safe, so concurrent first calls share one pool.
+inline std::unique_ptr<ThreadPool> &PoolSlot() {
+  static std::unique_ptr<ThreadPool> pool = [] {
+    size_t threads = std::thread::hardware_concurrency();
+    return std::make_unique<ThreadPool>(threads ? threads : 1);
+  }();
+  return pool;
+}
+
+// Chunks are at least this many elements, so tiny ranges stay serial and
+// every task streams through a few pages of contiguous memory.
+constexpr size_t kMinChunk = 1 << 14;
+
+inline size_t ChunkCount(size_t n, size_t threads) {
+  size_t chunks = std::min(threads * 4, (n + kMinChunk - 1) / kMinChunk);
+  return std::max<size_t>(chunks, 1);
+}
+
+template <class It>
+std::pair<It, It> Chunk(It first, size_t n, size_t chunks, size_t i) {
+  return {first + n * i / chunks, first + n * (i + 1) / chunks};
+}
+
+}  // namespace detail
+
+// The shared pool, one thread per hardware thread unless set_thread_count()
+// says otherwise. Safe to call from any number of threads at once.
+inline ThreadPool &Pool() { return *detail::PoolSlot(); }
+
+// Replaces the shared pool with one of the given size. Running algorithms
+// hold on to the old pool, so this must not race with any other call into
+// s21::parallel; set it up front, before the threads that use it start.
+inline void set_thread_count(size_t threads) {
+  detail::PoolSlot() = std::make_unique<ThreadPool>(threads ? threads : 1);
+}
+
+inline size_t thread_count() { return Pool().size(); }
+
+// Tag selecting the fork-join overloads of container operations, in the
+// spirit of std::execution::par.
+struct par_t {};
+inline constexpr par_t par{};
+
+template <class It, class F>
+void for_each(It first, It last, F f) {
+  size_t n = last - first;
+  size_t chunks = detail::ChunkCount(n, thread_count());
+  Pool().Run(chunks, [&](size_t i) {
+    auto range = detail::Chunk(first, n, chunks, i);
+    std::for_each(range.first, range.second, f);
+  });
+}
+
+template <class It, class Out, class F>
+Out transform(It first, It last, Out d_first, F op) {
+  size_t n = last - first;
+  size_t chunks = detail::ChunkCount(n, thread_count());
+  Pool().Run(chunks, [&](size_t i) {
+    auto range = detail::Chunk(first, n, chunks, i);
+    std::transform(range.first, range.second, d_first + (range.first - first),
+                   op);
+  });
+  return d_first + n;
+}
+
+// op must be associative; partial results are combined in order.
+template <class It, class T, class Op = std::plus<>>
+T reduce(It first, It last, T init, Op op = Op()) {
+  size_t n = last - first;
+  if (n == 0) return init;
+  size_t chunks = detail::ChunkCount(n, thread_count());
+  s21::Vector<T> partial(chunks);
+  Pool().Run(chunks, [&](size_t i) {
+    auto range = detail::Chunk(first, n, chunks, i);
+    partial[i] = std::accumulate(std::next(range.first), range.second,
+                                 T(*range.first), op);
+  });
+  for (size_t i = 0; i < chunks; ++i) init = op(init, partial[i]);
+  return init;
+}
+
+// Three passes: chunk totals, a serial prefix over the totals, then every
+// chunk scans again starting from its prefix.
+template <class It, class Out, class Op = std::plus<>>
+Out inclusive_scan(It first, It last, Out d_first, Op op = Op()) {
+  using T = typename std::iterator_traits<It>::value_type;
+  size_t n = last - first;
+  if (n == 0) return d_first;
+  size_t chunks = detail::ChunkCount(n, thread_count());
+  s21::Vector<T> total(chunks);
+  Pool().Run(chunks, [&](size_t i) {
+    auto range = detail::Chunk(first, n, chunks, i);
+    total[i] = std::accumulate(std::next(range.first), range.second,
+                               T(*range.first), op);
+  });
+  for (size_t i = 1; i < chunks; ++i) total[i] = op(total[i - 1], total[i]);
+  Pool().Run(chunks, [&](size_t i) {
+    auto range = detail::Chunk(first, n, chunks, i);
+    Out out = d_first + (range.first - first);
+    T sum = i ? op(total[i - 1], *range.first) : T(*range.first);
+    *out = sum;
+    for (It it = std::next(range.first); it != range.second; ++it) {
+      sum = op(sum, *it);
+      *++out = sum;
+    }
+  });
+  return d_first + n;
+}
+
+// Sorts chunks independently, then merges neighbouring runs pairwise, each
+// round in parallel.
+template <class It, class Compare = std::less<>>
+void sort(It first, It last, Compare comp = Compare()) {
+  size_t n = last - first;
+  size_t chunks = detail::ChunkCount(n, thread_count());
+  Pool().Run(chunks, [&](size_t i) {
+    auto range = detail::Chunk(first, n, chunks, i);
+    std::sort(range.first, range.second, comp);
+  });
+  for (size_t width = 1; width < chunks; width *= 2) {
+    size_t merges = (chunks + 2 * width - 1) / (2 * width);
+    Pool().Run(merges, [&](size_t i) {
+      size_t lo = 2 * width * i;
+      size_t mid = std::min(lo + width, chunks);
+      size_t hi = std::min(lo + 2 * width, chunks);
+      if (mid == hi) return;
+      std::inplace_merge(first + n * lo / chunks, first + n * mid / chunks,
+                         first + n * hi / chunks, comp);
+    });
+  }
+}
+
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_PARALLEL_H_
@@ -0,0 +1,372 @@
+#ifndef S21_CONTAINERS_SRC_S21_PERSISTENT_MAP_H_
+#define S21_CONTAINERS_SRC_S21_PERSISTENT_MAP_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+// Immutable sorted map. insert, insert_or_assign and erase leave *this
+// alone and return a new version that copies only the O(log n) nodes on
+// the path to key and shares every other subtree with the old one, so
+// versions cost memory in proportion to what changed between them.
+// Copying a version is O(1): a snapshot is just another reference to the
+// same root.
+//
+// Nodes are immutable and reference-counted atomically, so versions can be
+// read and dropped from any thread while a writer keeps building new ones.
+// A single persistent_map object is an ordinary value, though: replacing
+// it while another thread reads that same object is a data race, so hand
+// readers their own copy. The tree is kept AVL-balanced, which rebuilds
+// the path bottom-up without needing parent links that sharing forbids.
+// Iterators are valid as long as some version holding their nodes lives.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class persistent_map {
+  struct Node;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  // In-order walk over one version. path_ holds the ancestors of node_
+  // whose left subtree the walk is in, i.e. the nodes still to be visited
+  // on the way back up.
+  class PersistentMapIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = persistent_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    PersistentMapIterator() = default;
+
+    // only the live part of the path is copied
+    PersistentMapIterator(const PersistentMapIterator &other)
+        : node_(other.node_), depth_(other.depth_) {
+      std::copy(other.path_, other.path_ + depth_, path_);
+    }
+
+    PersistentMapIterator &operator=(const PersistentMapIterator &other) {
+      node_ = other.node_;
+      depth_ = other.depth_;
+      std::copy(other.path_, other.path_ + depth_, path_);
+      return *this;
+    }
+
+    reference operator*() const { return node_->data; }
+    pointer operator->() const { return &node_->data; }
+
+    PersistentMapIterator &operator++() {
+      if (node_->right) {
+        Descend(node_->right);
+      } else if (depth_ == 0) {
+        node_ = nullptr;
+      } else {
+        node_ = path_[--depth_];
+      }
+      return *this;
+    }
+
+    PersistentMapIterator operator++(int) {
+      PersistentMapIterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    bool operator==(const PersistentMapIterator &other) const {
+      return node_ == other.node_;
+    }
+    bool operator!=(const PersistentMapIterator &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    // Moves to the smallest node under node.
+    void Descend(const Node *node) {
+      for (; node->left; node = node->left) path_[depth_++] = node;
+      node_ = node;
+    }
+
+    // An AVL tree of height h holds at least Fib(h + 2) - 1 nodes, so no
+    // tree that fits in memory is anywhere near this deep.
+    static constexpr int kMaxDepth = 96;
+
+    const Node *node_ = nullptr;
+    const Node *path_[kMaxDepth];
+    int depth_ = 0;
+    friend class persistent_map;
+  };
+
+  using iterator = PersistentMapIterator;
+  using const_iterator = PersistentMapIterator;
+
+  persistent_map() = default;
+
+  explicit persistent_map(const Compare &comp) : compare_(comp) {}
+
+  persistent_map(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) *this = insert(item);
+  }
+
+  persistent_map(const persistent_map &other) noexcept
+      : root_(Share(other.root_)), size_(other.size_),
+        compare_(other.compare_) {}
+
+  persistent_map(persistent_map &&other) noexcept
+      : root_(other.root_), size_(other.size_), compare_(other.compare_) {
+    other.root_ = nullptr;
+    other.size_ = 0;
+  }
+
+  persistent_map &operator=(const persistent_map &other) noexcept {
+    persistent_map copy(other);
+    swap(copy);
+    return *this;
+  }
+
+  persistent_map &operator=(persistent_map &&other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  ~persistent_map() { Drop(root_); }
+
+  const_iterator begin() const {
+    const_iterator it;
+    if (root_) it.Descend(root_);
+    return it;
+  }
+  const_iterator end() const { return const_iterator(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(Node);
+  }
+
+  void swap(persistent_map &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    std::swap(compare_, other.compare_);
+  }
+
+  const mapped_type &at(const key_type &key) const {
+    const Node *node = FindNode(key);
+    if (!node) throw std::out_of_range("Key not found");
+    return node->data.second;
+  }
+
+  const_iterator find(const key_type &key) const {
+    const_iterator it;
+    const Node *node = root_;
+    while (node) {
+      if (compare_(key, node->data.first)) {
+        it.path_[it.depth_++] = node;
+        node = node->left;
+      } else if (compare_(node->data.first, key)) {
+        node = node->right;
+      } else {
+        break;
+      }
+    }
+    it.node_ = node;
+    if (!node) it.depth_ = 0;
+    return it;
+  }
+
+  bool contains(const key_type &key) const { return FindNode(key); }
+  size_type count(const key_type &key) const { return contains(key); }
+
+  // The version with key mapped to obj; *this itself when key is present.
+  [[nodiscard]] persistent_map insert(const value_type &value) const {
+    return Update(value.first, value.second, false);
+  }
+
+  [[nodiscard]] persistent_map insert(const key_type &key,
+                                      const mapped_type &obj) const {
+    return Update(key, obj, false);
+  }
+
+  // The version with key mapped to obj whether or not it was present.
+  [[nodiscard]] persistent_map insert_or_assign(const key_type &key,
+                                                const mapped_type &obj) const {
+    return Update(key, obj, true);
+  }
+
+  // The version without key; *this itself when key is absent.
+  [[nodiscard]] persistent_map erase(const key_type &key) const {
+    bool removed = false;
+    const Node *root = Erase(root_, key, removed);
+    if (!removed) return *this;
+    return persistent_map(root, size_ - 1, compare_);
+  }
+
+  key_compare key_comp() const { return compare_; }
+
+ private:
+  struct Node {
+    Node(const value_type &value, const Node *l, const Node *r)
+        : data(value), left(l), right(r),
+          height(1 + std::max(Height(l), Height(r))) {}
+
+    mutable std::atomic<size_t> refs{1};
+    value_type data;
+    const Node *left;
+    const Node *right;
+    int height;
+  };
+
+  persistent_map(const Node *root, size_type size, const Compare &comp)
+      : root_(root), size_(size), compare_(comp) {}
+
+  static int Height(const Node *node) { return node ? node->height : 0; }
+
+  static const Node *Share(const Node *node) {
+    if (node) node->refs.fetch_add(1, std::memory_order_relaxed);
+    return node;
+  }
+
+  // Recursion only follows nodes this call frees, so it is bounded by the
+  // height of the tree.
+  static void Drop(const Node *node) {
+    if (node && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      Drop(node->left);
+      Drop(node->right);
+      delete node;
+    }
+  }
+
+  // Builds a node over left and right, taking over the caller's reference
+  // to each, and restores the AVL invariant with at most two rotations.
+  // The nodes rotated out of place are rebuilt, never modified.
+  static const Node *Balance(const value_type &value, const Node *left,
+                             const Node *right) {
+    if (Height(left) > Height(right) + 1) {
+      const Node *l = left;
+      const Node *result;
+      if (Height(l->left) >= Height(l->right)) {
+        result = new Node(l->data, Share(l->left),
+                          new Node(value, Share(l->right), right));
+      } else {
+        const Node *lr = l->right;
+        result = new Node(lr->data,
+                          new Node(l->data, Share(l->left), Share(lr->left)),
+                          new Node(value, Share(lr->right), right));
+      }
+      Drop(l);
+      return result;
+    }
+    if (Height(right) > Height(left) + 1) {
+      const Node *r = right;
+      const Node *result;
+      if (Height(r->right) >= Height(r->left)) {
+        result = new Node(r->data, new Node(value, left, Share(r->left)),
+                          Share(r->right));
+      } else {
+        const Node *rl = r->left;
+        result = new Node(rl->data, new Node(value, left, Share(rl->left)),
+                          new Node(r->data, Share(rl->right), Share(r->right)));
+      }
+      Drop(r);
+      return result;
+    }
+    return new Node(value, left, right);
+  }
+
+  const Node *FindNode(const key_type &key) const {
+    const Node *node = root_;
+    while (node) {
+      if (compare_(key, node->data.first)) {
+        node = node->left;
+      } else if (compare_(node->data.first, key)) {
+        node = node->right;
+      } else {
+        break;
+      }
+    }
+    return node;
+  }
+
+  persistent_map Update(const key_type &key, const mapped_type &obj,
+                        bool assign) const {
+    bool added = false;
+    const Node *root = Insert(root_, key, obj, assign, added);
+    if (!root) return *this;
+    return persistent_map(root, size_ + added, compare_);
+  }
+
+  // The new subtree, or null when nothing changed.
+  const Node *Insert(const Node *node, const key_type &key,
+                     const mapped_type &obj, bool assign, bool &added) const {
+    if (!node) {
+      added = true;
+      return new Node(value_type(key, obj), nullptr, nullptr);
+    }
+    if (compare_(key, node->data.first)) {
+      const Node *left = Insert(node->left, key, obj, assign, added);
+      if (!left) return nullptr;
+      return Balance(node->data, left, Share(node->right));
+    }
+    if (compare_(node->data.first, key)) {
+      const Node *right = Insert(node->right, key, obj, assign, added);
+      if (!right) return nullptr;
+      return Balance(node->data, Share(node->left), right);
+    }
+    if (!assign) return nullptr;
+    return new Node(value_type(key, obj), Share(node->left),
+                    Share(node->right));
+  }
+
+  // The new subtree, which may be empty; removed says whether key was
+  // found at all.
+  const Node *Erase(const Node *node, const key_type &key,
+                    bool &removed) const {
+    if (!node) return nullptr;
+    if (compare_(key, node->data.first)) {
+      const Node *left = Erase(node->left, key, removed);
+      if (!removed) return nullptr;
+      return Balance(node->data, left, Share(node->right));
+    }
+    if (compare_(node->data.first, key)) {
+      const Node *right = Erase(node->right, key, removed);
+      if (!removed) return nullptr;
+      return Balance(node->data, Share(node->left), right);
+    }
+    removed = true;
+    if (!node->left) return Share(node->right);
+    if (!node->right) return Share(node->left);
+    const Node *next = nullptr;
+    const Node *right = EraseMin(node->right, next);
+    return Balance(next->data, Share(node->left), right);
+  }
+
+  // node's subtree without its smallest node, which is returned in min.
+  static const Node *EraseMin(const Node *node, const Node *&min) {
+    if (!node->left) {
+      min = node;
+      return Share(node->right);
+    }
+    const Node *left = EraseMin(node->left, min);
+    return Balance(node->data, left, Share(node->right));
+  }
+
+  const Node *root_ = nullptr;
+  size_type size_ = 0;
+  Compare compare_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_PERSISTENT_MAP_H_
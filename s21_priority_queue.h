@@ -0,0 +1,295 @@
+#ifndef S21_CONTAINERS_SRC_S21_PRIORITY_QUEUE_H_
+#define S21_CONTAINERS_SRC_S21_PRIORITY_QUEUE_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+namespace detail {
+
+// Four children per node: half the depth of a binary heap, and the children
+// of a node are adjacent so picking the best one stays within a cache line
+// or two for small element types.
+constexpr size_t kHeapArity = 4;
+
+inline size_t HeapParent(size_t i) { return (i - 1) / kHeapArity; }
+inline size_t HeapFirstChild(size_t i) { return i * kHeapArity + 1; }
+
+}  // namespace detail
+
+// Max-heap adapter in the style of std::priority_queue: top() is the element
+// no other element compares greater than under Compare, so pass
+// std::greater<T> for a min-queue. Container needs operator[], push_back,
+// pop_back, size and empty.
+template <class T, class Container = s21::Vector<T>,
+          class Compare = std::less<typename Container::value_type>>
+class PriorityQueue {
+ public:
+  using value_type = typename Container::value_type;
+  using reference = typename Container::reference;
+  using const_reference = typename Container::const_reference;
+  using size_type = typename Container::size_type;
+  using container_type = Container;
+  using value_compare = Compare;
+
+  PriorityQueue() : Adapter(), comp_() {}
+  explicit PriorityQueue(const Compare& comp) : Adapter(), comp_(comp) {}
+
+  // Builds the heap bottom-up in O(n).
+  PriorityQueue(std::initializer_list<value_type> const& items,
+                const Compare& comp = Compare())
+      : Adapter(), comp_(comp) {
+    for (const_reference item : items) Adapter.push_back(item);
+    for (size_type i = Adapter.size() / detail::kHeapArity + 1; i-- > 0;) {
+      SiftDown(i);
+    }
+  }
+
+  const_reference top() { return Adapter[0]; }
+
+  bool empty() { return Adapter.empty(); }
+
+  size_type size() { return Adapter.size(); }
+
+  void push(const_reference value) {
+    Adapter.push_back(value);
+    SiftUp(Adapter.size() - 1);
+  }
+
+  void pop() {
+    if (Adapter.empty()) return;
+    size_type last = Adapter.size() - 1;
+    if (last) Adapter[0] = std::move(Adapter[last]);
+    Adapter.pop_back();
+    SiftDown(0);
+  }
+
+  void swap(PriorityQueue& other) {
+    Adapter.swap(other.Adapter);
+    std::swap(comp_, other.comp_);
+  }
+
+  template <class... Args>
+  void insert_many_back(Args&&... args) {
+    for (auto value : {std::forward<Args>(args)...}) push(value);
+  }
+
+ private:
+  // Both sifts carry the moving element in a hole instead of swapping.
+  void SiftUp(size_type i) {
+    value_type value = std::move(Adapter[i]);
+    while (i > 0) {
+      size_type parent = detail::HeapParent(i);
+      if (!comp_(Adapter[parent], value)) break;
+      Adapter[i] = std::move(Adapter[parent]);
+      i = parent;
+    }
+    Adapter[i] = std::move(value);
+  }
+
+  void SiftDown(size_type i) {
+    size_type n = Adapter.size();
+    if (i >= n) return;
+    value_type value = std::move(Adapter[i]);
+    for (;;) {
+      size_type child = detail::HeapFirstChild(i);
+      if (child >= n) break;
+      size_type last = std::min(child + detail::kHeapArity, n);
+      size_type best = child;
+      for (++child; child < last; ++child) {
+        if (comp_(Adapter[best], Adapter[child])) best = child;
+      }
+      if (!comp_(value, Adapter[best])) break;
+      Adapter[i] = std::move(Adapter[best]);
+      i = best;
+    }
+    Adapter[i] = std::move(value);
+  }
+
+  Container Adapter;
+  Compare comp_;
+};
+
+// PriorityQueue whose elements can be found again: push() returns a handle
+// that stays valid until the element is popped or erased, and
+// update()/decrease_key()/erase() reach the element in O(1) and restore the
+// heap in O(log n). Slots of removed elements are recycled, but a handle
+// carries the generation of its slot, so a stale one is never mistaken for
+// the element that took its place.
+template <class T, class Compare = std::less<T>>
+class IndexedPriorityQueue {
+ public:
+  using value_type = T;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using handle = uint64_t;
+
+  IndexedPriorityQueue() = default;
+  explicit IndexedPriorityQueue(const Compare& comp) : comp_(comp) {}
+
+  const_reference top() { return heap_[0].value; }
+  handle top_handle() { return MakeHandle(heap_[0].id); }
+
+  bool empty() { return heap_.empty(); }
+  size_type size() { return heap_.size(); }
+
+  bool contains(handle h) {
+    uint32_t index = static_cast<uint32_t>(h);
+    return index < slots_.size() && slots_[index].generation == h >> 32 &&
+           slots_[index].pos != kNone;
+  }
+
+  const_reference operator[](handle h) { return heap_[Position(h)].value; }
+
+  handle push(const_reference value) {
+    uint32_t index;
+    if (free_.empty()) {
+      index = static_cast<uint32_t>(slots_.size());
+      slots_.push_back(Slot{heap_.size(), 0});
+    } else {
+      index = free_.back();
+      free_.pop_back();
+      slots_[index].pos = heap_.size();
+    }
+    heap_.push_back(Entry{value, index});
+    SiftUp(heap_.size() - 1);
+    return MakeHandle(index);
+  }
+
+  void pop() {
+    if (!heap_.empty()) Remove(0);
+  }
+
+  void erase(handle h) {
+    Check(h);
+    Remove(Position(h));
+  }
+
+  // Replaces the element behind h and moves it whichever way it must go.
+  void update(handle h, const_reference value) {
+    Check(h);
+    size_type i = Position(h);
+    bool up = comp_(heap_[i].value, value);
+    heap_[i].value = value;
+    if (up) {
+      SiftUp(i);
+    } else {
+      SiftDown(i);
+    }
+  }
+
+  // Moves h towards the top; value must not compare less than the current
+  // one. With std::greater this is the textbook decrease-key of a min-heap.
+  void decrease_key(handle h, const_reference value) {
+    Check(h);
+    size_type i = Position(h);
+    if (comp_(value, heap_[i].value)) {
+      throw std::invalid_argument("decrease_key would lower the priority");
+    }
+    heap_[i].value = value;
+    SiftUp(i);
+  }
+
+  void swap(IndexedPriorityQueue& other) {
+    heap_.swap(other.heap_);
+    slots_.swap(other.slots_);
+    free_.swap(other.free_);
+    std::swap(comp_, other.comp_);
+  }
+
+ private:
+  struct Entry {
+    T value;
+    uint32_t id;  // slot index
+  };
+
+  struct Slot {
+    size_type pos;        // heap position, kNone if free
+    uint32_t generation;  // bumped whenever the slot is freed
+  };
+
+  static constexpr size_type kNone = std::numeric_limits<size_type>::max();
+
+  handle MakeHandle(uint32_t index) const {
+    return static_cast<handle>(slots_[index].generation) << 32 | index;
+  }
+
+  size_type Position(handle h) const {
+    return slots_[static_cast<uint32_t>(h)].pos;
+  }
+
+  void Check(handle h) {
+    if (!contains(h)) throw std::out_of_range("Invalid handle");
+  }
+
+  void Remove(size_type i) {
+    uint32_t index = heap_[i].id;
+    slots_[index].pos = kNone;
+    ++slots_[index].generation;
+    free_.push_back(index);
+    size_type last = heap_.size() - 1;
+    if (i == last) {
+      heap_.pop_back();
+      return;
+    }
+    bool up = comp_(heap_[i].value, heap_[last].value);
+    Place(i, std::move(heap_[last]));
+    heap_.pop_back();
+    if (up) {
+      SiftUp(i);
+    } else {
+      SiftDown(i);
+    }
+  }
+
+  void Place(size_type i, Entry&& entry) {
+    slots_[entry.id].pos = i;
+    heap_[i] = std::move(entry);
+  }
+
+  void SiftUp(size_type i) {
+    Entry entry = std::move(heap_[i]);
+    while (i > 0) {
+      size_type parent = detail::HeapParent(i);
+      if (!comp_(heap_[parent].value, entry.value)) break;
+      Place(i, std::move(heap_[parent]));
+      i = parent;
+    }
+    Place(i, std::move(entry));
+  }
+
+  void SiftDown(size_type i) {
+    size_type n = heap_.size();
+    Entry entry = std::move(heap_[i]);
+    for (;;) {
+      size_type child = detail::HeapFirstChild(i);
+      if (child >= n) break;
+      size_type last = std::min(child + detail::kHeapArity, n);
+      size_type best = child;
+      for (++child; child < last; ++child) {
+        if (comp_(heap_[best].value, heap_[child].value)) best = child;
+      }
+      if (!comp_(entry.value, heap_[best].value)) break;
+      Place(i, std::move(heap_[best]));
+      i = best;
+    }
+    Place(i, std::move(entry));
+  }
+
+  s21::Vector<Entry> heap_;
+  s21::Vector<Slot> slots_;
+  s21::Vector<uint32_t> free_;
+  Compare comp_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_PRIORITY_QUEUE_H_
@@ -0,0 +1,280 @@
+#ifndef S21_CONTAINERS_SRC_S21_SERIALIZATION_H_
+#define S21_CONTAINERS_SRC_S21_SERIALIZATION_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+namespace serialization {
+
+// Every container is stored as
+//   [byte order tag : 1 byte][element count : 8 bytes][elements...]
+// in the byte order of the writing host. Trivially copyable elements are
+// written as raw bytes, std::string as an 8-byte length plus characters and
+// std::pair as its two members. A reader on a host with the other byte order
+// swaps arithmetic values and rejects anything it can't swap.
+//
+// Counts and string lengths come from outside, so they are checked against
+// the bytes the reader has left, or read in bounded chunks where that is
+// unknown, before anything is sized by them.
+
+constexpr uint8_t kLittleEndian = 1;
+constexpr uint8_t kBigEndian = 2;
+
+// Most bytes a reader allocates ahead of data it has not seen yet.
+constexpr size_t kReadChunk = size_t(1) << 20;
+
+inline uint8_t HostByteOrder() {
+  const uint16_t probe = 1;
+  uint8_t first;
+  std::memcpy(&first, &probe, 1);
+  return first ? kLittleEndian : kBigEndian;
+}
+
+class StreamWriter {
+ public:
+  explicit StreamWriter(std::ostream &os) : os_(os), count_(0) {}
+
+  void Write(const void *data, size_t size) {
+    os_.write(static_cast<const char *>(data), size);
+    if (!os_) throw std::runtime_error("Write failed");
+    count_ += size;
+  }
+
+  size_t count() const { return count_; }
+
+ private:
+  std::ostream &os_;
+  size_t count_;
+};
+
+class BufferWriter {
+ public:
+  BufferWriter(char *buffer, size_t size)
+      : buffer_(buffer), size_(size), count_(0) {}
+
+  void Write(const void *data, size_t size) {
+    if (size > size_ - count_) throw std::length_error("Buffer too small");
+    std::memcpy(buffer_ + count_, data, size);
+    count_ += size;
+  }
+
+  size_t count() const { return count_; }
+
+ private:
+  char *buffer_;
+  size_t size_;
+  size_t count_;
+};
+
+// Writer that only measures, used to size buffers for BufferWriter.
+class SizeCounter {
+ public:
+  SizeCounter() : count_(0) {}
+
+  void Write(const void *, size_t size) { count_ += size; }
+
+  size_t count() const { return count_; }
+
+ private:
+  size_t count_;
+};
+
+class StreamReader {
+ public:
+  explicit StreamReader(std::istream &is)
+      : swap_bytes(false), is_(is), count_(0) {}
+
+  void Read(void *data, size_t size) {
+    is_.read(static_cast<char *>(data), size);
+    if (!is_) throw std::runtime_error("Unexpected end of data");
+    count_ += size;
+  }
+
+  size_t count() const { return count_; }
+
+  // Bytes left in a seekable stream; kUnknown for pipes and the like.
+  size_t remaining() {
+    std::istream::pos_type here = is_.tellg();
+    if (here == std::istream::pos_type(-1)) return kUnknown;
+    is_.seekg(0, std::ios::end);
+    std::istream::pos_type end = is_.tellg();
+    is_.seekg(here);
+    if (!is_ || end < here) {
+      is_.clear();
+      return kUnknown;
+    }
+    return size_t(end - here);
+  }
+
+  static constexpr size_t kUnknown = std::numeric_limits<size_t>::max();
+
+  bool swap_bytes;
+
+ private:
+  std::istream &is_;
+  size_t count_;
+};
+
+class BufferReader {
+ public:
+  BufferReader(const char *buffer, size_t size)
+      : swap_bytes(false), buffer_(buffer), size_(size), count_(0) {}
+
+  void Read(void *data, size_t size) {
+    if (size > size_ - count_)
+      throw std::runtime_error("Unexpected end of data");
+    std::memcpy(data, buffer_ + count_, size);
+    count_ += size;
+  }
+
+  size_t count() const { return count_; }
+
+  size_t remaining() const { return size_ - count_; }
+
+  bool swap_bytes;
+
+ private:
+  const char *buffer_;
+  size_t size_;
+  size_t count_;
+};
+
+template <class T>
+void ByteSwap(T &value) {
+  if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+    char *bytes = reinterpret_cast<char *>(&value);
+    std::reverse(bytes, bytes + sizeof(T));
+  } else {
+    throw std::runtime_error("Byte order mismatch");
+  }
+}
+
+template <class Writer, class T>
+void WriteValue(Writer &w, const T &value) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "element type has no binary encoding");
+  w.Write(&value, sizeof(T));
+}
+
+template <class Writer>
+void WriteValue(Writer &w, const std::string &value) {
+  uint64_t length = value.size();
+  w.Write(&length, sizeof(length));
+  w.Write(value.data(), value.size());
+}
+
+template <class Writer, class A, class B>
+void WriteValue(Writer &w, const std::pair<A, B> &value) {
+  WriteValue(w, value.first);
+  WriteValue(w, value.second);
+}
+
+template <class Reader, class T>
+void ReadValue(Reader &r, T &value) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "element type has no binary encoding");
+  r.Read(&value, sizeof(T));
+  if (r.swap_bytes) ByteSwap(value);
+}
+
+template <class Reader>
+void ReadValue(Reader &r, std::string &value) {
+  uint64_t length;
+  ReadValue(r, length);
+  if constexpr (std::is_same_v<Reader, BufferReader>) {
+    if (length > r.remaining())
+      throw std::runtime_error("String length exceeds the data");
+    value.resize(length);
+    r.Read(value.data(), length);
+  } else {
+    // a stream can't say how much is left without seeking, so the string
+    // grows chunk by chunk and a bad length fails at the end of the data
+    value.clear();
+    while (value.size() < length) {
+      size_t done = value.size();
+      size_t chunk = std::min<uint64_t>(length - done, kReadChunk);
+      value.resize(done + chunk);
+      r.Read(&value[done], chunk);
+    }
+  }
+}
+
+template <class Reader, class A, class B>
+void ReadValue(Reader &r, std::pair<A, B> &value) {
+  ReadValue(r, value.first);
+  ReadValue(r, value.second);
+}
+
+// Trivially copyable runs are moved with a single Write()/Read().
+template <class Writer, class T>
+void WriteArray(Writer &w, const T *data, size_t size) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    w.Write(data, size * sizeof(T));
+  } else {
+    for (size_t i = 0; i < size; ++i) WriteValue(w, data[i]);
+  }
+}
+
+template <class Reader, class T>
+void ReadArray(Reader &r, T *data, size_t size) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "ReadArray fills raw memory of trivially copyable types");
+  r.Read(data, size * sizeof(T));
+  if (r.swap_bytes) {
+    for (size_t i = 0; i < size; ++i) ByteSwap(data[i]);
+  }
+}
+
+// The fewest bytes one element of type T takes in a dump.
+template <class T>
+struct MinEncodedSize {
+  static constexpr size_t value = sizeof(T);
+};
+
+template <>
+struct MinEncodedSize<std::string> {
+  static constexpr size_t value = sizeof(uint64_t);
+};
+
+template <class A, class B>
+struct MinEncodedSize<std::pair<A, B>> {
+  static constexpr size_t value =
+      MinEncodedSize<std::remove_const_t<A>>::value + MinEncodedSize<B>::value;
+};
+
+template <class Writer>
+void WriteHeader(Writer &w, uint64_t size) {
+  uint8_t order = HostByteOrder();
+  w.Write(&order, sizeof(order));
+  w.Write(&size, sizeof(size));
+}
+
+// Returns the element count, which is known to fit in the rest of the
+// data as far as the reader can tell.
+template <class T, class Reader>
+uint64_t ReadHeader(Reader &r) {
+  uint8_t order;
+  r.Read(&order, sizeof(order));
+  if (order != kLittleEndian && order != kBigEndian)
+    throw std::runtime_error("Bad byte order tag");
+  r.swap_bytes = order != HostByteOrder();
+  uint64_t size;
+  ReadValue(r, size);
+  if (size > r.remaining() / MinEncodedSize<T>::value)
+    throw std::runtime_error("Element count exceeds the data");
+  return size;
+}
+
+}  // namespace serialization
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_SERIALIZATION_H_
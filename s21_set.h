@@ -1,24 +1,40 @@
 #ifndef S21_CONTAINERS_SRC_S21_SET_H_
 #define S21_CONTAINERS_SRC_S21_SET_H_
+#include <functional>
 #include <limits>
 
+#include "s21_parallel.h"
+#include "s21_serialization.h"
 #include "trees/s21_red_black_tree.h"
 
-template <typename T>
+// Lookups by any type the comparator accepts (find, contains, count,
+// lower_bound, erase) are enabled when Compare declares is_transparent, as
+// std::less<> does.
+template <typename T, typename Compare = std::less<T>>
 class set {
  public:
-  typedef RedBlackTree<T, T> tree;
+  typedef RedBlackTree<T, T, Compare> tree;
   typedef T key_type;
   typedef T value_type;
   typedef T Key;
+  typedef Compare key_compare;
   typedef T &reference;
   typedef const T &const_reference;
   typedef typename tree::iterator iterator;
   typedef typename tree::const_iterator const_iterator;
   typedef size_t size_type;
+  typedef typename tree::NodeHandle node_type;
+
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
+  };
 
   set() = default;
 
+  explicit set(const Compare &comp) : tree_(comp) {}
+
   set(std::initializer_list<value_type> const &items) {
     for (auto i = items.begin(); i < items.end(); i++) {
       tree_.AddNode(*i, *i);
@@ -52,58 +68,194 @@ class set {
 
   size_type max_size() { return std::numeric_limits<size_type>::max(); };
 
-  void clear() {
-    for (auto it = begin(), en = end(); it != en;) {
-      tree_.DeleteNode(*it);
-      it = begin();
-    }
-  }
+  void clear() { tree_.Clear(); }
 
   std::pair<iterator, bool> insert(const value_type &value) {
-    bool inserted = false;
-    if (tree_.FindNode(value) == NULL) {
-      tree_.AddNode(value, value);
-      inserted = true;
-    }
-    iterator pos(tree_.FindNode(value));
-    return std::make_pair(pos, inserted);
+    auto added = tree_.AddNode(value, value);
+    return std::make_pair(iterator(added.first, &tree_), added.second);
+  }
+
+  // Takes the node back from an extract(); nothing is copied. When the
+  // value is already present, node comes back in the result untouched.
+  insert_return_type insert(node_type &&node) {
+    insert_return_type result{end(), false, std::move(node)};
+    if (result.node.empty()) return result;
+    result.position = iterator(tree_.Insert(result.node), &tree_);
+    result.inserted = result.node.empty();
+    return result;
   }
 
   void erase(iterator pos) {
-    if (pos != NULL && tree_.GetSize() > 0 && tree_.FindNode(*pos) != NULL) {
+    if (pos != end() && tree_.GetSize() > 0 && tree_.FindNode(*pos) != NULL) {
       tree_.DeleteNode(*pos);
     }
   }
 
-  void swap(set &other) {
-    set temp(*this);
-    *this = other;
-    other = temp;
+  void swap(set &other) noexcept { tree_.swap(other.tree_); }
+
+  size_type erase(const Key &key) { return EraseKey(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type erase(const K &key) {
+    return EraseKey(key);
+  }
+
+  // Unlinks the element from the set and returns it as a node handle, or
+  // an empty handle for end() and absent keys.
+  node_type extract(iterator pos) {
+    if (pos == end()) return node_type();
+    return tree_.Extract(pos.operator->());
   }
 
-  void merge(set &other) {
-    for (auto it = other.begin(), et = other.end(); it != et; ++it) {
-      tree_.AddNode(*it, *it);
-    }
-    other.clear();
+  node_type extract(const key_type &key) {
+    return tree_.Extract(tree_.FindNode(key));
+  }
+
+  // Relinks the nodes of other whose values are missing here; the others
+  // stay in other. No element is copied or allocated.
+  void merge(set &other) { tree_.Merge(other.tree_); }
+
+  // In-place union, intersection and difference with other, which is left
+  // untouched. All four run in O(m log(n / m + 1)) by join and split.
+  void unite(const set &other) { tree_.Unite(other.tree_); }
+  void intersect(const set &other) { tree_.Intersect(other.tree_); }
+  void subtract(const set &other) { tree_.Subtract(other.tree_); }
+
+  // Same, with the independent halves of the recursion run on the
+  // s21::parallel pool.
+  void merge(s21::parallel::par_t, set &other) {
+    tree_.Merge(other.tree_, ParallelFork());
+  }
+  void unite(s21::parallel::par_t, const set &other) {
+    tree_.Unite(other.tree_, ParallelFork());
+  }
+  void intersect(s21::parallel::par_t, const set &other) {
+    tree_.Intersect(other.tree_, ParallelFork());
+  }
+  void subtract(s21::parallel::par_t, const set &other) {
+    tree_.Subtract(other.tree_, ParallelFork());
   }
 
   iterator find(const Key &key) {
-    if (tree_.FindNode(key)) {
-      iterator pos(tree_.FindNode(key));
-      return pos;
-    } else {
-      return ++iterator(tree_.MaxInTree());
-    }
+    return iterator(tree_.FindNode(key), &tree_);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) {
+    return iterator(tree_.FindNode(key), &tree_);
+  }
+
+  bool contains(const Key &key) { return tree_.FindNode(key) != NULL; }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) {
+    return tree_.FindNode(key) != NULL;
   }
 
-  bool contains(const Key &key) {
-    bool found = false;
-    if (tree_.FindNode(key)) found = true;
-    return found;
+  size_type count(const Key &key) { return contains(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const K &key) {
+    return contains(key);
+  }
+
+  // First element not ordered before key, or end().
+  iterator lower_bound(const Key &key) {
+    return iterator(tree_.LowerBound(key), &tree_);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) {
+    return iterator(tree_.LowerBound(key), &tree_);
+  }
+
+  key_compare key_comp() const { return tree_.KeyComp(); }
+
+  void serialize(std::ostream &os) {
+    s21::serialization::StreamWriter writer(os);
+    Save(writer);
+  }
+
+  size_type serialize(char *buffer, size_type size) {
+    s21::serialization::BufferWriter writer(buffer, size);
+    Save(writer);
+    return writer.count();
+  }
+
+  size_type serialized_size() {
+    s21::serialization::SizeCounter writer;
+    Save(writer);
+    return writer.count();
+  }
+
+  void deserialize(std::istream &is) {
+    s21::serialization::StreamReader reader(is);
+    Load(reader);
+  }
+
+  size_type deserialize(const char *buffer, size_type size) {
+    s21::serialization::BufferReader reader(buffer, size);
+    Load(reader);
+    return reader.count();
   }
 
  private:
+  template <typename K>
+  size_type EraseKey(const K &key) {
+    auto *node = tree_.FindNode(key);
+    if (node == NULL) return 0;
+    tree_.Extract(node);
+    return 1;
+  }
+
+  // Forks only near the top of the recursion, while the subtree driving it
+  // still holds thousands of nodes (black height 10 means at least 1023).
+  struct ParallelFork {
+    template <typename Left, typename Right>
+    void operator()(int depth, const s21::RbHook *node, Left left,
+                    Right right) {
+      if (depth >= kMaxForkDepth || s21::parallel::thread_count() == 1 ||
+          s21::RbTree::BlackHeight(node) < kMinForkBlackHeight) {
+        left();
+        right();
+        return;
+      }
+      s21::parallel::Pool().Run(2, [&](size_t i) {
+        if (i == 0) {
+          left();
+        } else {
+          right();
+        }
+      });
+    }
+    static constexpr int kMaxForkDepth = 8;
+    static constexpr size_t kMinForkBlackHeight = 10;
+  };
+
+  template <typename Writer>
+  void Save(Writer &writer) {
+    s21::serialization::WriteHeader(writer, size());
+    for (auto it = begin(); it != end(); ++it) {
+      s21::serialization::WriteValue(writer, *it);
+    }
+  }
+
+  // keys come out of Save() sorted, so the tree is rebuilt in O(n)
+  template <typename Reader>
+  void Load(Reader &reader) {
+    uint64_t n = s21::serialization::ReadHeader<value_type>(reader);
+    tree_.BuildSorted(n, [&reader] {
+      value_type value;
+      s21::serialization::ReadValue(reader, value);
+      return std::make_pair(value, value);
+    });
+  }
+
   tree tree_;
 };
 
@@ -0,0 +1,458 @@
+#ifndef S21_CONTAINERS_SRC_S21_SIMD_H_
+#define S21_CONTAINERS_SRC_S21_SIMD_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define S21_SIMD_X86 1
+#define S21_SIMD_AVX2 __attribute__((target("avx2")))
+#define S21_SIMD_SSE42 __attribute__((target("sse4.2")))
+#else
+#define S21_SIMD_X86 0
+#endif
+
+namespace s21 {
+namespace simd {
+
+// Search and reduction kernels for contiguous ranges (Vector and Array
+// iterators are plain pointers). int32_t and float ranges run AVX2 or SSE4.2
+// code picked at runtime from what the CPU supports; every other arithmetic
+// type, and CPUs without either extension, use the scalar loop.
+//   auto it = s21::simd::find(v.begin(), v.end(), 42);
+// Float min/max/sum do not handle NaN, and sum adds in a different order
+// than a plain loop does.
+
+enum class Level { kScalar, kSse42, kAvx2 };
+
+inline Level detected_level() {
+  static const Level level = [] {
+#if S21_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return Level::kAvx2;
+    if (__builtin_cpu_supports("sse4.2")) return Level::kSse42;
+#endif
+    return Level::kScalar;
+  }();
+  return level;
+}
+
+namespace detail {
+
+inline Level &ActiveLevel() {
+  static Level level = detected_level();
+  return level;
+}
+
+template <class T>
+constexpr bool kVectorized =
+    S21_SIMD_X86 && (std::is_same_v<T, int32_t> || std::is_same_v<T, float>);
+
+#if S21_SIMD_X86
+
+// ---- AVX2 ----------------------------------------------------------------
+
+S21_SIMD_AVX2 inline size_t FindAvx2(const int32_t *p, size_t n, int32_t x) {
+  __m256i needle = _mm256_set1_epi32(x);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+    int mask = _mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(v, needle)));
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  for (; i < n && p[i] != x; ++i) {
+  }
+  return i;
+}
+
+S21_SIMD_AVX2 inline size_t FindAvx2(const float *p, size_t n, float x) {
+  __m256 needle = _mm256_set1_ps(x);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    int mask = _mm256_movemask_ps(
+        _mm256_cmp_ps(_mm256_loadu_ps(p + i), needle, _CMP_EQ_OQ));
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  for (; i < n && p[i] != x; ++i) {
+  }
+  return i;
+}
+
+S21_SIMD_AVX2 inline size_t CountAvx2(const int32_t *p, size_t n, int32_t x) {
+  __m256i needle = _mm256_set1_epi32(x);
+  size_t count = 0, i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+    count += __builtin_popcount(_mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(v, needle))));
+  }
+  for (; i < n; ++i) count += p[i] == x;
+  return count;
+}
+
+S21_SIMD_AVX2 inline size_t CountAvx2(const float *p, size_t n, float x) {
+  __m256 needle = _mm256_set1_ps(x);
+  size_t count = 0, i = 0;
+  for (; i + 8 <= n; i += 8) {
+    count += __builtin_popcount(_mm256_movemask_ps(
+        _mm256_cmp_ps(_mm256_loadu_ps(p + i), needle, _CMP_EQ_OQ)));
+  }
+  for (; i < n; ++i) count += p[i] == x;
+  return count;
+}
+
+S21_SIMD_AVX2 inline std::pair<int32_t, int32_t> MinMaxAvx2(const int32_t *p,
+                                                            size_t n) {
+  int32_t lo = p[0], hi = p[0];
+  size_t i = 0;
+  if (n >= 8) {
+    __m256i vmin = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    __m256i vmax = vmin;
+    for (i = 8; i + 8 <= n; i += 8) {
+      __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+      vmin = _mm256_min_epi32(vmin, v);
+      vmax = _mm256_max_epi32(vmax, v);
+    }
+    int32_t lanes_min[8], lanes_max[8];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes_min), vmin);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes_max), vmax);
+    lo = *std::min_element(lanes_min, lanes_min + 8);
+    hi = *std::max_element(lanes_max, lanes_max + 8);
+  }
+  for (; i < n; ++i) {
+    lo = std::min(lo, p[i]);
+    hi = std::max(hi, p[i]);
+  }
+  return {lo, hi};
+}
+
+S21_SIMD_AVX2 inline std::pair<float, float> MinMaxAvx2(const float *p,
+                                                        size_t n) {
+  float lo = p[0], hi = p[0];
+  size_t i = 0;
+  if (n >= 8) {
+    __m256 vmin = _mm256_loadu_ps(p), vmax = vmin;
+    for (i = 8; i + 8 <= n; i += 8) {
+      __m256 v = _mm256_loadu_ps(p + i);
+      vmin = _mm256_min_ps(vmin, v);
+      vmax = _mm256_max_ps(vmax, v);
+    }
+    float lanes_min[8], lanes_max[8];
+    _mm256_storeu_ps(lanes_min, vmin);
+    _mm256_storeu_ps(lanes_max, vmax);
+    lo = *std::min_element(lanes_min, lanes_min + 8);
+    hi = *std::max_element(lanes_max, lanes_max + 8);
+  }
+  for (; i < n; ++i) {
+    lo = std::min(lo, p[i]);
+    hi = std::max(hi, p[i]);
+  }
+  return {lo, hi};
+}
+
+S21_SIMD_AVX2 inline int64_t SumAvx2(const int32_t *p, size_t n) {
+  __m256i acc = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+    acc = _mm256_add_epi64(
+        acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+    acc = _mm256_add_epi64(
+        acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+  }
+  int64_t lanes[4];
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), acc);
+  int64_t sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+  for (; i < n; ++i) sum += p[i];
+  return sum;
+}
+
+S21_SIMD_AVX2 inline double SumAvx2(const float *p, size_t n) {
+  __m256d acc = _mm256_setzero_pd();
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    acc = _mm256_add_pd(acc, _mm256_cvtps_pd(_mm_loadu_ps(p + i)));
+  }
+  double lanes[4];
+  _mm256_storeu_pd(lanes, acc);
+  double sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+  for (; i < n; ++i) sum += p[i];
+  return sum;
+}
+
+S21_SIMD_AVX2 inline void FillAvx2(int32_t *p, size_t n, int32_t x) {
+  __m256i v = _mm256_set1_epi32(x);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p + i), v);
+  }
+  for (; i < n; ++i) p[i] = x;
+}
+
+// ---- SSE4.2 --------------------------------------------------------------
+
+S21_SIMD_SSE42 inline size_t FindSse(const int32_t *p, size_t n, int32_t x) {
+  __m128i needle = _mm_set1_epi32(x);
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, needle)));
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  for (; i < n && p[i] != x; ++i) {
+  }
+  return i;
+}
+
+S21_SIMD_SSE42 inline size_t FindSse(const float *p, size_t n, float x) {
+  __m128 needle = _mm_set1_ps(x);
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p + i), needle));
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  for (; i < n && p[i] != x; ++i) {
+  }
+  return i;
+}
+
+S21_SIMD_SSE42 inline size_t CountSse(const int32_t *p, size_t n, int32_t x) {
+  __m128i needle = _mm_set1_epi32(x);
+  size_t count = 0, i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+    count += __builtin_popcount(
+        _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, needle))));
+  }
+  for (; i < n; ++i) count += p[i] == x;
+  return count;
+}
+
+S21_SIMD_SSE42 inline size_t CountSse(const float *p, size_t n, float x) {
+  __m128 needle = _mm_set1_ps(x);
+  size_t count = 0, i = 0;
+  for (; i + 4 <= n; i += 4) {
+    count += __builtin_popcount(
+        _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p + i), needle)));
+  }
+  for (; i < n; ++i) count += p[i] == x;
+  return count;
+}
+
+S21_SIMD_SSE42 inline std::pair<int32_t, int32_t> MinMaxSse(const int32_t *p,
+                                                            size_t n) {
+  int32_t lo = p[0], hi = p[0];
+  size_t i = 0;
+  if (n >= 4) {
+    __m128i vmin = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    __m128i vmax = vmin;
+    for (i = 4; i + 4 <= n; i += 4) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+      vmin = _mm_min_epi32(vmin, v);
+      vmax = _mm_max_epi32(vmax, v);
+    }
+    int32_t lanes_min[4], lanes_max[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes_min), vmin);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes_max), vmax);
+    lo = *std::min_element(lanes_min, lanes_min + 4);
+    hi = *std::max_element(lanes_max, lanes_max + 4);
+  }
+  for (; i < n; ++i) {
+    lo = std::min(lo, p[i]);
+    hi = std::max(hi, p[i]);
+  }
+  return {lo, hi};
+}
+
+S21_SIMD_SSE42 inline std::pair<float, float> MinMaxSse(const float *p,
+                                                        size_t n) {
+  float lo = p[0], hi = p[0];
+  size_t i = 0;
+  if (n >= 4) {
+    __m128 vmin = _mm_loadu_ps(p), vmax = vmin;
+    for (i = 4; i + 4 <= n; i += 4) {
+      __m128 v = _mm_loadu_ps(p + i);
+      vmin = _mm_min_ps(vmin, v);
+      vmax = _mm_max_ps(vmax, v);
+    }
+    float lanes_min[4], lanes_max[4];
+    _mm_storeu_ps(lanes_min, vmin);
+    _mm_storeu_ps(lanes_max, vmax);
+    lo = *std::min_element(lanes_min, lanes_min + 4);
+    hi = *std::max_element(lanes_max, lanes_max + 4);
+  }
+  for (; i < n; ++i) {
+    lo = std::min(lo, p[i]);
+    hi = std::max(hi, p[i]);
+  }
+  return {lo, hi};
+}
+
+S21_SIMD_SSE42 inline int64_t SumSse(const int32_t *p, size_t n) {
+  __m128i acc = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+    acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(v));
+    acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(_mm_srli_si128(v, 8)));
+  }
+  int64_t lanes[2];
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), acc);
+  int64_t sum = lanes[0] + lanes[1];
+  for (; i < n; ++i) sum += p[i];
+  return sum;
+}
+
+S21_SIMD_SSE42 inline double SumSse(const float *p, size_t n) {
+  __m128d acc = _mm_setzero_pd();
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    __m128 two = _mm_castpd_ps(
+        _mm_load_sd(reinterpret_cast<const double *>(p + i)));
+    acc = _mm_add_pd(acc, _mm_cvtps_pd(two));
+  }
+  double lanes[2];
+  _mm_storeu_pd(lanes, acc);
+  double sum = lanes[0] + lanes[1];
+  for (; i < n; ++i) sum += p[i];
+  return sum;
+}
+
+S21_SIMD_SSE42 inline void FillSse(int32_t *p, size_t n, int32_t x) {
+  __m128i v = _mm_set1_epi32(x);
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p + i), v);
+  }
+  for (; i < n; ++i) p[i] = x;
+}
+
+#endif  // S21_SIMD_X86
+
+}  // namespace detail
+
+inline Level level() { return detail::ActiveLevel(); }
+
+// Lowers (or restores) the kernels in use; never above detected_level().
+inline void set_level(Level level) {
+  detail::ActiveLevel() = std::min(level, detected_level());
+}
+
+template <class T>
+using sum_type =
+    std::conditional_t<std::is_floating_point_v<T>, double,
+                       std::conditional_t<std::is_signed_v<T>, int64_t,
+                                          uint64_t>>;
+
+template <class T>
+const T *find(const T *first, const T *last, const T &value) {
+  static_assert(std::is_arithmetic_v<T>, "arithmetic element types only");
+  size_t n = last - first;
+#if S21_SIMD_X86
+  if constexpr (detail::kVectorized<T>) {
+    if (level() == Level::kAvx2) {
+      return first + detail::FindAvx2(first, n, value);
+    }
+    if (level() == Level::kSse42) {
+      return first + detail::FindSse(first, n, value);
+    }
+  }
+#endif
+  return std::find(first, first + n, value);
+}
+
+template <class T>
+T *find(T *first, T *last, const T &value) {
+  return const_cast<T *>(
+      find(static_cast<const T *>(first), static_cast<const T *>(last), value));
+}
+
+template <class T>
+bool contains(const T *first, const T *last, const T &value) {
+  return find(first, last, value) != last;
+}
+
+template <class T>
+size_t count(const T *first, const T *last, const T &value) {
+  static_assert(std::is_arithmetic_v<T>, "arithmetic element types only");
+  size_t n = last - first;
+#if S21_SIMD_X86
+  if constexpr (detail::kVectorized<T>) {
+    if (level() == Level::kAvx2) return detail::CountAvx2(first, n, value);
+    if (level() == Level::kSse42) return detail::CountSse(first, n, value);
+  }
+#endif
+  return std::count(first, last, value);
+}
+
+template <class T>
+std::pair<T, T> minmax(const T *first, const T *last) {
+  static_assert(std::is_arithmetic_v<T>, "arithmetic element types only");
+  if (first == last) throw std::invalid_argument("empty range");
+  size_t n = last - first;
+#if S21_SIMD_X86
+  if constexpr (detail::kVectorized<T>) {
+    if (level() == Level::kAvx2) return detail::MinMaxAvx2(first, n);
+    if (level() == Level::kSse42) return detail::MinMaxSse(first, n);
+  }
+#endif
+  auto result = std::minmax_element(first, last);
+  return {*result.first, *result.second};
+}
+
+template <class T>
+T min(const T *first, const T *last) {
+  return minmax(first, last).first;
+}
+
+template <class T>
+T max(const T *first, const T *last) {
+  return minmax(first, last).second;
+}
+
+template <class T>
+sum_type<T> sum(const T *first, const T *last) {
+  static_assert(std::is_arithmetic_v<T>, "arithmetic element types only");
+  size_t n = last - first;
+#if S21_SIMD_X86
+  if constexpr (detail::kVectorized<T>) {
+    if (level() == Level::kAvx2) return detail::SumAvx2(first, n);
+    if (level() == Level::kSse42) return detail::SumSse(first, n);
+  }
+#endif
+  sum_type<T> total = 0;
+  for (const T *it = first; it != last; ++it) total += *it;
+  return total;
+}
+
+template <class T>
+void fill(T *first, T *last, const T &value) {
+  static_assert(std::is_arithmetic_v<T>, "arithmetic element types only");
+  size_t n = last - first;
+#if S21_SIMD_X86
+  if constexpr (detail::kVectorized<T>) {
+    int32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    int32_t *p = reinterpret_cast<int32_t *>(first);
+    if (level() == Level::kAvx2) return detail::FillAvx2(p, n, bits);
+    if (level() == Level::kSse42) return detail::FillSse(p, n, bits);
+  }
+#endif
+  std::fill(first, first + n, value);
+}
+
+}  // namespace simd
+}  // namespace s21
+
+#undef S21_SIMD_AVX2
+#undef S21_SIMD_SSE42
+#undef S21_SIMD_X86
+
+#endif  // S21_CONTAINERS_SRC_S21_SIMD_H_
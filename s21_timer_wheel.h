@@ -0,0 +1,240 @@
+#ifndef S21_CONTAINERS_SRC_S21_TIMER_WHEEL_H_
+#define S21_CONTAINERS_SRC_S21_TIMER_WHEEL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "s21_deque.h"
+#include "s21_intrusive_list.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Hierarchical timer wheel over integer ticks. Level L has kSlots buckets,
+// each covering kSlots^L ticks; a timer sits in the lowest level whose span
+// still reaches its deadline and drops a level each time the wheel turns
+// past its bucket, so every timer is touched at most kLevels times however
+// far away it is. Deadlines beyond the top level wait in an overflow bucket
+// that is redistributed once per top-level turn.
+//
+// Buckets are IntrusiveLists threaded through pooled entries, so schedule()
+// and cancel() are O(1) and allocate only when the pool grows. Handles carry
+// a generation, so cancelling a timer that already fired is a safe no-op.
+template <typename T>
+class TimerWheel {
+ public:
+  using value_type = T;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using time_point = uint64_t;
+  using handle = uint64_t;
+
+  static constexpr unsigned kSlotBits = 8;
+  static constexpr size_type kSlots = size_type(1) << kSlotBits;
+  static constexpr unsigned kLevels = 4;
+
+  explicit TimerWheel(time_point now = 0) : current_(now) {}
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+  ~TimerWheel() { clear(); }
+
+  // Last tick advance() has processed.
+  time_point now() const noexcept { return current_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+
+  // Fires at the first advance() reaching deadline; a deadline that has
+  // already passed fires on the next advance().
+  handle schedule(time_point deadline, const_reference value) {
+    uint32_t index;
+    if (free_.empty()) {
+      index = static_cast<uint32_t>(pool_.size());
+      pool_.push_back(Entry{ListHook(), deadline, index, 0, 0, value});
+    } else {
+      index = free_.back();
+      free_.pop_back();
+      pool_[index].deadline = deadline;
+      pool_[index].value = value;
+    }
+    Place(pool_[index], current_ + 1);
+    ++size_;
+    return static_cast<handle>(pool_[index].generation) << 32 | index;
+  }
+
+  // Returns false when h has already fired or been cancelled.
+  bool cancel(handle h) {
+    uint32_t index = static_cast<uint32_t>(h);
+    if (index >= pool_.size()) return false;
+    Entry& entry = pool_[index];
+    if (entry.generation != h >> 32 || !entry.hook.is_linked()) return false;
+    Unlink(entry);
+    Release(index);
+    return true;
+  }
+
+  // Processes every tick up to now, calling visit(T&) on each timer that
+  // expires, in deadline order. visit may schedule or cancel timers; new
+  // ones land no earlier than the tick after the one being fired.
+  template <typename Visitor>
+  size_type advance(time_point now, Visitor visit) {
+    size_type fired = 0;
+    while (current_ < now && size_) {
+      time_point tick = Skip(current_ + 1, now);
+      if (tick > now) break;
+      for (unsigned level = kLevels; level > 0; --level) {
+        if (tick & (Span(level) - 1)) continue;
+        Cascade(level == kLevels ? overflow_ : Bucket(level, tick), tick);
+      }
+      current_ = tick;
+      fired += Fire(tick, visit);
+    }
+    if (now > current_) current_ = now;
+    return fired;
+  }
+
+  // Same as above, collecting the expired values instead.
+  s21::Vector<value_type> advance(time_point now) {
+    s21::Vector<value_type> expired;
+    advance(now, [&expired](value_type& value) {
+      expired.push_back(std::move(value));
+    });
+    return expired;
+  }
+
+  // Drops every pending timer without firing it.
+  void clear() noexcept {
+    for (auto& level : wheel_) {
+      for (auto& bucket : level) bucket.clear();
+    }
+    overflow_.clear();
+    for (size_type& count : counts_) count = 0;
+    free_.clear();
+    for (size_type i = 0; i < pool_.size(); ++i) {
+      ++pool_[i].generation;
+      free_.push_back(static_cast<uint32_t>(i));
+    }
+    size_ = 0;
+  }
+
+ private:
+  struct Entry {
+    ListHook hook;
+    time_point deadline;
+    uint32_t index;       // position in pool_
+    uint32_t generation;  // bumped whenever the slot is freed
+    unsigned level;       // wheel level, kLevels for the overflow bucket
+    value_type value;
+  };
+
+  using Bucket_ = IntrusiveList<Entry, &Entry::hook>;
+
+  static constexpr time_point Span(unsigned level) {
+    return time_point(1) << (level * kSlotBits);
+  }
+
+  static size_type Index(time_point tick, unsigned level) {
+    return (tick >> (level * kSlotBits)) & (kSlots - 1);
+  }
+
+  Bucket_& Bucket(unsigned level, time_point tick) {
+    return wheel_[level][Index(tick, level)];
+  }
+
+  // Files entry relative to base, the next tick to be processed: level L
+  // when the deadline shares every digit above L with base. A deadline in
+  // the past is moved up to base.
+  void Place(Entry& entry, time_point base) {
+    if (entry.deadline < base) entry.deadline = base;
+    time_point deadline = entry.deadline;
+    for (unsigned level = 0; level < kLevels; ++level) {
+      if ((deadline ^ base) >> ((level + 1) * kSlotBits) == 0) {
+        Bucket(level, deadline).push_back(entry);
+        entry.level = level;
+        ++counts_[level];
+        return;
+      }
+    }
+    overflow_.push_back(entry);
+    entry.level = kLevels;
+  }
+
+  void Unlink(Entry& entry) noexcept {
+    if (entry.level < kLevels) {
+      Bucket(entry.level, entry.deadline).remove(entry);
+      --counts_[entry.level];
+    } else {
+      overflow_.remove(entry);
+    }
+  }
+
+  void Release(uint32_t index) {
+    ++pool_[index].generation;
+    free_.push_back(index);
+    --size_;
+  }
+
+  // Refiles a bucket the wheel has just turned onto; its entries all move
+  // to lower levels (or stay in overflow when still out of range).
+  void Cascade(Bucket_& bucket, time_point tick) {
+    Bucket_ moving;
+    while (!bucket.empty()) {
+      Entry& entry = bucket.front();
+      bucket.pop_front();
+      moving.push_back(entry);
+    }
+    while (!moving.empty()) {
+      Entry& entry = moving.front();
+      moving.pop_front();
+      if (entry.level < kLevels) --counts_[entry.level];
+      Place(entry, tick);
+    }
+  }
+
+  // First tick at or after tick where something can fire or cascade: a run
+  // of empty low levels lets the wheel jump to the next boundary above them.
+  time_point Skip(time_point tick, time_point now) const {
+    unsigned empty = 0;
+    while (empty < kLevels && counts_[empty] == 0) ++empty;
+    if (empty == 0 || (tick & (Span(empty) - 1)) == 0) return tick;
+    time_point boundary = (tick | (Span(empty) - 1)) + 1;
+    return boundary > now ? now + 1 : boundary;
+  }
+
+  // Runs the level-0 bucket of tick. An entry is freed only after visit
+  // returns, so visit can't be handed a slot recycled under its feet. If
+  // visit throws, the tick is rewound so the rest fire on the next advance.
+  template <typename Visitor>
+  size_type Fire(time_point tick, Visitor& visit) {
+    Bucket_& bucket = Bucket(0, tick);
+    size_type fired = 0;
+    while (!bucket.empty()) {
+      Entry& entry = bucket.front();
+      bucket.pop_front();
+      --counts_[0];
+      try {
+        visit(entry.value);
+      } catch (...) {
+        Release(entry.index);
+        current_ = tick - 1;
+        throw;
+      }
+      Release(entry.index);
+      ++fired;
+    }
+    return fired;
+  }
+
+  Bucket_ wheel_[kLevels][kSlots];
+  Bucket_ overflow_;
+  size_type counts_[kLevels] = {};
+  s21::Deque<Entry> pool_;
+  s21::Vector<uint32_t> free_;
+  time_point current_;
+  size_type size_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_TIMER_WHEEL_H_
@@ -0,0 +1,399 @@
+#ifndef S21_CONTAINERS_SRC_S21_UNROLLED_LIST_H_
+#define S21_CONTAINERS_SRC_S21_UNROLLED_LIST_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// Doubly linked list of fixed-size blocks, each holding a run of elements,
+// so a sequential walk touches one cache line per several elements instead
+// of one per element. BlockBytes is the target size of a block, header
+// included.
+//
+// push/pop at either end are O(1) and leave every other iterator valid.
+// insert/erase in the middle shift elements within one block, splitting a
+// full block or merging an underfull one into its successor; iterators into
+// the blocks involved are invalidated.
+template <typename T, size_t BlockBytes = 512>
+class UnrolledList {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+ private:
+  // Elements of a block live in slots [first, last). The sentinel is a bare
+  // BlockBase with first == last == 0.
+  struct BlockBase {
+    BlockBase* next;
+    BlockBase* prev;
+    size_type first;
+    size_type last;
+  };
+
+ public:
+  static constexpr size_type kBlockCapacity =
+      (BlockBytes - sizeof(BlockBase)) / sizeof(T) > 4
+          ? (BlockBytes - sizeof(BlockBase)) / sizeof(T)
+          : 4;
+
+  class UnrolledListConstIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    UnrolledListConstIterator() : block(nullptr), index(0) {}
+    UnrolledListConstIterator(const BlockBase* other, size_type i)
+        : block(const_cast<BlockBase*>(other)), index(i) {}
+
+    const_reference operator*() const noexcept { return *slot(block, index); }
+    const T* operator->() const noexcept { return slot(block, index); }
+
+    UnrolledListConstIterator& operator++() noexcept {
+      if (++index == block->last) {
+        block = block->next;
+        index = block->first;
+      }
+      return *this;
+    }
+
+    UnrolledListConstIterator& operator--() noexcept {
+      if (index == block->first) {
+        block = block->prev;
+        index = block->last;
+      }
+      --index;
+      return *this;
+    }
+
+    bool operator==(const UnrolledListConstIterator& other) const noexcept {
+      return block == other.block && index == other.index;
+    }
+
+    bool operator!=(const UnrolledListConstIterator& other) const noexcept {
+      return !(*this == other);
+    }
+
+   protected:
+    BlockBase* block;
+    size_type index;
+    friend class UnrolledList;
+  };
+
+  class UnrolledListIterator : public UnrolledListConstIterator {
+   public:
+    using pointer = T*;
+    using reference = T&;
+
+    UnrolledListIterator() = default;
+    UnrolledListIterator(BlockBase* other, size_type i)
+        : UnrolledListConstIterator(other, i) {}
+
+    reference operator*() const noexcept {
+      return *slot(this->block, this->index);
+    }
+    T* operator->() const noexcept { return slot(this->block, this->index); }
+
+    UnrolledListIterator& operator++() noexcept {
+      UnrolledListConstIterator::operator++();
+      return *this;
+    }
+
+    UnrolledListIterator& operator--() noexcept {
+      UnrolledListConstIterator::operator--();
+      return *this;
+    }
+  };
+
+  using iterator = UnrolledListIterator;
+  using const_iterator = UnrolledListConstIterator;
+
+  UnrolledList() : end_{&end_, &end_, 0, 0}, size_(0) {}
+
+  UnrolledList(std::initializer_list<value_type> const& items)
+      : UnrolledList() {
+    for (const_reference item : items) push_back(item);
+  }
+
+  UnrolledList(const UnrolledList& other) : UnrolledList() {
+    for (const_reference item : other) push_back(item);
+  }
+
+  UnrolledList(UnrolledList&& other) noexcept : UnrolledList() {
+    swap(other);
+  }
+
+  ~UnrolledList() { clear(); }
+
+  UnrolledList& operator=(const UnrolledList& other) {
+    if (this != &other) {
+      UnrolledList copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  UnrolledList& operator=(UnrolledList&& other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  reference front() noexcept { return *begin(); }
+  const_reference front() const noexcept { return *begin(); }
+  reference back() noexcept { return *slot(end_.prev, end_.prev->last - 1); }
+  const_reference back() const noexcept {
+    return *slot(end_.prev, end_.prev->last - 1);
+  }
+
+  iterator begin() noexcept { return iterator(end_.next, end_.next->first); }
+  const_iterator begin() const noexcept {
+    return const_iterator(end_.next, end_.next->first);
+  }
+  iterator end() noexcept { return iterator(&end_, 0); }
+  const_iterator end() const noexcept { return const_iterator(&end_, 0); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+  }
+
+  void clear() noexcept {
+    BlockBase* block = end_.next;
+    while (block != &end_) {
+      BlockBase* next = block->next;
+      for (size_type i = block->first; i < block->last; ++i) {
+        slot(block, i)->~value_type();
+      }
+      delete static_cast<Block*>(block);
+      block = next;
+    }
+    end_.next = end_.prev = &end_;
+    size_ = 0;
+  }
+
+  void push_back(const_reference value) {
+    BlockBase* tail = end_.prev;
+    if (tail == &end_ || tail->last == kBlockCapacity) {
+      tail = new Block(&end_, 0);
+      try {
+        new (slot(tail, 0)) value_type(value);
+      } catch (...) {
+        unlink(tail);
+        delete static_cast<Block*>(tail);
+        throw;
+      }
+    } else {
+      new (slot(tail, tail->last)) value_type(value);
+    }
+    ++tail->last;
+    ++size_;
+  }
+
+  void push_front(const_reference value) {
+    BlockBase* head = end_.next;
+    if (head == &end_ || head->first == 0) {
+      head = new Block(end_.next, kBlockCapacity);
+      try {
+        new (slot(head, kBlockCapacity - 1)) value_type(value);
+      } catch (...) {
+        unlink(head);
+        delete static_cast<Block*>(head);
+        throw;
+      }
+    } else {
+      new (slot(head, head->first - 1)) value_type(value);
+    }
+    --head->first;
+    ++size_;
+  }
+
+  void pop_back() noexcept {
+    BlockBase* tail = end_.prev;
+    slot(tail, --tail->last)->~value_type();
+    --size_;
+    if (tail->first == tail->last) release(tail);
+  }
+
+  void pop_front() noexcept {
+    BlockBase* head = end_.next;
+    slot(head, head->first++)->~value_type();
+    --size_;
+    if (head->first == head->last) release(head);
+  }
+
+  // Inserts before pos and returns an iterator to the new element.
+  iterator insert(const_iterator pos, const_reference value) {
+    if (pos == end()) {
+      push_back(value);
+      return iterator(end_.prev, end_.prev->last - 1);
+    }
+    value_type copy(value);
+    BlockBase* block = pos.block;
+    size_type index = pos.index;
+    if (block->first == 0 && block->last == kBlockCapacity) {
+      // full: move the upper half into a fresh block after this one
+      size_type half = kBlockCapacity / 2;
+      BlockBase* upper = new Block(block->next, 0);
+      for (size_type i = half; i < kBlockCapacity; ++i) {
+        new (slot(upper, upper->last++)) value_type(std::move(*slot(block, i)));
+        slot(block, i)->~value_type();
+      }
+      block->last = half;
+      if (index >= half) {
+        block = upper;
+        index -= half;
+      }
+    }
+    if (block->last < kBlockCapacity) {
+      // open a gap at index by shifting the tail of the run right
+      if (index == block->last) {
+        new (slot(block, index)) value_type(std::move(copy));
+      } else {
+        new (slot(block, block->last))
+            value_type(std::move(*slot(block, block->last - 1)));
+        for (size_type i = block->last - 1; i > index; --i) {
+          *slot(block, i) = std::move(*slot(block, i - 1));
+        }
+        *slot(block, index) = std::move(copy);
+      }
+      ++block->last;
+    } else {
+      // no room at the back: shift the head of the run left instead
+      if (index == block->first) {
+        new (slot(block, index - 1)) value_type(std::move(copy));
+      } else {
+        new (slot(block, block->first - 1))
+            value_type(std::move(*slot(block, block->first)));
+        for (size_type i = block->first; i + 1 < index; ++i) {
+          *slot(block, i) = std::move(*slot(block, i + 1));
+        }
+        *slot(block, index - 1) = std::move(copy);
+      }
+      --block->first;
+      --index;
+    }
+    ++size_;
+    return iterator(block, index);
+  }
+
+  // Erases pos and returns an iterator to the element that followed it.
+  iterator erase(const_iterator pos) noexcept {
+    BlockBase* block = pos.block;
+    size_type index = pos.index;
+    for (size_type i = index; i + 1 < block->last; ++i) {
+      *slot(block, i) = std::move(*slot(block, i + 1));
+    }
+    slot(block, --block->last)->~value_type();
+    --size_;
+    if (block->first == block->last) {
+      BlockBase* next = block->next;
+      release(block);
+      return iterator(next, next->first);
+    }
+    BlockBase* next = block->next;
+    if (next != &end_ &&
+        count(block) + count(next) <= kBlockCapacity / 2) {
+      // underfull pair: pack this run to the front and pull next into it
+      if (block->first != 0) {
+        size_type shift = block->first;
+        for (size_type i = block->first; i < block->last; ++i) {
+          new (slot(block, i - shift)) value_type(std::move(*slot(block, i)));
+          slot(block, i)->~value_type();
+        }
+        block->first = 0;
+        block->last -= shift;
+        index -= shift;
+      }
+      for (size_type i = next->first; i < next->last; ++i) {
+        new (slot(block, block->last++))
+            value_type(std::move(*slot(next, i)));
+        slot(next, i)->~value_type();
+      }
+      next->last = next->first;
+      release(next);
+    }
+    if (index == block->last) return iterator(block->next, block->next->first);
+    return iterator(block, index);
+  }
+
+  void swap(UnrolledList& other) noexcept {
+    std::swap(end_.next, other.end_.next);
+    std::swap(end_.prev, other.end_.prev);
+    std::swap(size_, other.size_);
+    anchor();
+    other.anchor();
+  }
+
+  bool operator==(const UnrolledList& other) const noexcept {
+    if (size_ != other.size_) return false;
+    for (const_iterator a = begin(), b = other.begin(); a != end(); ++a, ++b) {
+      if (!(*a == *b)) return false;
+    }
+    return true;
+  }
+
+  bool operator!=(const UnrolledList& other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  struct Block : BlockBase {
+    // Links in before pos, with the empty run starting at slot start.
+    Block(BlockBase* pos, size_type start)
+        : BlockBase{pos, pos->prev, start, start} {
+      pos->prev->next = this;
+      pos->prev = this;
+    }
+    alignas(value_type) unsigned char storage[kBlockCapacity * sizeof(T)];
+  };
+
+  static T* slot(BlockBase* block, size_type i) noexcept {
+    return std::launder(
+        reinterpret_cast<T*>(static_cast<Block*>(block)->storage) + i);
+  }
+
+  static size_type count(const BlockBase* block) noexcept {
+    return block->last - block->first;
+  }
+
+  static void unlink(BlockBase* block) noexcept {
+    block->prev->next = block->next;
+    block->next->prev = block->prev;
+  }
+
+  // Frees a block whose run is already empty.
+  static void release(BlockBase* block) noexcept {
+    unlink(block);
+    delete static_cast<Block*>(block);
+  }
+
+  // Points the first and last block back at this list's sentinel.
+  void anchor() noexcept {
+    if (size_ == 0) {
+      end_.next = end_.prev = &end_;
+    } else {
+      end_.next->prev = &end_;
+      end_.prev->next = &end_;
+    }
+  }
+
+  BlockBase end_;
+  size_type size_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_UNROLLED_LIST_H_
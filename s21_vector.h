@@ -1,16 +1,35 @@
 #ifndef S21_CONTAINERS_SRC_S21_VECTOR_H_
 #define S21_CONTAINERS_SRC_S21_VECTOR_H_
+#include <algorithm>
+#include <cstdint>
 #include <exception>
 #include <initializer_list>
 #include <iostream>
 #include <memory>
 #include <new>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
+#include "s21_serialization.h"
+
 namespace s21 {
 
+// Default Vector storage: plain operator new / operator delete. A storage
+// policy may also grow a buffer without copying through Reallocate(); the
+// heap one can't, so it always reports failure and Vector falls back to a copy.
 template <class T>
+struct HeapStorage {
+  static T *Allocate(size_t n) {
+    return n ? reinterpret_cast<T *>(operator new(n * sizeof(T))) : nullptr;
+  }
+
+  static void Deallocate(T *p, size_t) { operator delete(p); }
+
+  static T *Reallocate(T *, size_t, size_t) { return nullptr; }
+};
+
+template <class T, class Storage = HeapStorage<T>>
 
 class Vector {
  public:
@@ -26,11 +45,7 @@ class Vector {
   Vector() : size_(0U), capacity_(0U), arr_(nullptr){};
 
   explicit Vector(size_type n)
-      : size_(n),
-        capacity_(n),
-        arr_(n ? reinterpret_cast<value_type *>(operator new(
-                     capacity_ * sizeof(value_type)))
-               : nullptr) {
+      : size_(n), capacity_(n), arr_(Storage::Allocate(n)) {
     for (size_type i = 0; i < n; ++i) {
       new (arr_ + i) value_type();
     }
@@ -40,21 +55,20 @@ class Vector {
     if (items.size() > max_size()) throw std::bad_alloc();
     size_ = items.size();
     capacity_ = items.size();
-    arr_ = reinterpret_cast<value_type *>(operator new(capacity_ *
-                                                       sizeof(value_type)));
-    std::uninitialized_copy(items.begin(), items.end(), arr_);
+    arr_ = Storage::Allocate(capacity_);
+    if (size_) std::uninitialized_copy(items.begin(), items.end(), arr_);
   }
 
   Vector(const Vector &v) {
     size_ = v.size_;
     capacity_ = v.capacity_;
-    arr_ = reinterpret_cast<value_type *>(operator new(capacity_ *
-                                                       sizeof(value_type)));
+    arr_ = Storage::Allocate(capacity_);
+    // no buffer means no capacity, so nothing to copy either
+    if (!arr_) return;
     try {
       std::uninitialized_copy(v.arr_, v.arr_ + v.size_, arr_);
     } catch (...) {
-      // delete[] reinterpret_cast<int8_t *>(arr_);
-      operator delete(arr_);
+      Storage::Deallocate(arr_, capacity_);
       throw std::bad_alloc();
     }
   }
@@ -69,8 +83,7 @@ class Vector {
     for (size_type i = 0; i < size_; ++i) {
       (arr_ + i)->~T();
     }
-    // delete[] reinterpret_cast<int8_t *>(arr_);
-    operator delete(arr_);
+    Storage::Deallocate(arr_, capacity_);
   }
 
   Vector &operator=(Vector &&v) noexcept {
@@ -126,45 +139,13 @@ class Vector {
   size_type max_size() { return SIZE_MAX / sizeof(value_type); }
 
   void reserve(size_type size) {
-    if (size > capacity_) {
-      value_type *newarr = reinterpret_cast<value_type *>(operator new(
-          size * sizeof(value_type)));
-      try {
-        std::uninitialized_copy(arr_, arr_ + size_, newarr);
-      } catch (...) {
-        operator delete(newarr);
-        throw;
-      }
-      for (size_type i = 0; i < size_; ++i) {
-        (arr_ + i)->~T();
-      }
-      operator delete(arr_);
-      // delete[] reinterpret_cast<int8_t *>(arr_);
-      arr_ = newarr;
-      capacity_ = size;
-    }
+    if (size > capacity_) Relocate(size);
   }
 
   size_type capacity() { return capacity_; }
 
   void shrink_to_fit() {
-    if (size_ < capacity_) {
-      value_type *newarr = reinterpret_cast<value_type *>(operator new(
-          size_ * sizeof(value_type)));
-      try {
-        std::uninitialized_copy(arr_, arr_ + size_, newarr);
-      } catch (...) {
-        operator delete(newarr);
-        throw;
-      }
-      for (size_type i = 0; i < size_; ++i) {
-        (arr_ + i)->~T();
-      }
-      // delete[] reinterpret_cast<int8_t *>(arr_);
-      operator delete(arr_);
-      arr_ = newarr;
-      capacity_ = size_;
-    }
+    if (size_ < capacity_) Relocate(size_);
   }
 
   //* Vector Modifiers
@@ -237,7 +218,96 @@ class Vector {
     }
   }
 
+  //* Vector Serialization
+
+  void serialize(std::ostream &os) {
+    serialization::StreamWriter writer(os);
+    Save(writer);
+  }
+
+  size_type serialize(char *buffer, size_type size) {
+    serialization::BufferWriter writer(buffer, size);
+    Save(writer);
+    return writer.count();
+  }
+
+  size_type serialized_size() {
+    serialization::SizeCounter writer;
+    Save(writer);
+    return writer.count();
+  }
+
+  void deserialize(std::istream &is) {
+    serialization::StreamReader reader(is);
+    Load(reader);
+  }
+
+  size_type deserialize(const char *buffer, size_type size) {
+    serialization::BufferReader reader(buffer, size);
+    Load(reader);
+    return reader.count();
+  }
+
  private:
+  template <class Writer>
+  void Save(Writer &writer) {
+    serialization::WriteHeader(writer, size_);
+    serialization::WriteArray(writer, arr_, size_);
+  }
+
+  template <class Reader>
+  void Load(Reader &reader) {
+    uint64_t n = serialization::ReadHeader<value_type>(reader);
+    if (n > max_size()) throw std::length_error("Too many elements");
+    clear();
+    // ReadHeader can't bound n for a stream it can't seek, so the buffer
+    // grows with the data that actually arrives rather than trusting n
+    reserve(std::min<uint64_t>(n, kLoadChunk));
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      while (size_ < n) {
+        if (size_ == capacity_) reserve(std::min<uint64_t>(n, 2 * capacity_));
+        size_type m = std::min<uint64_t>(n - size_, capacity_ - size_);
+        serialization::ReadArray(reader, arr_ + size_, m);
+        size_ += m;
+      }
+    } else {
+      for (uint64_t i = 0; i < n; ++i) {
+        value_type value;
+        serialization::ReadValue(reader, value);
+        push_back(std::move(value));
+      }
+    }
+  }
+
+  // Elements Load() reserves before any arrive, about a megabyte.
+  static constexpr size_type kLoadChunk = (size_type(1) << 20) / sizeof(T) + 1;
+
+  void Relocate(size_type n) {
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      if (n > 0) {
+        value_type *moved = Storage::Reallocate(arr_, capacity_, n);
+        if (moved) {
+          arr_ = moved;
+          capacity_ = n;
+          return;
+        }
+      }
+    }
+    value_type *newarr = Storage::Allocate(n);
+    try {
+      if (size_) std::uninitialized_copy(arr_, arr_ + size_, newarr);
+    } catch (...) {
+      Storage::Deallocate(newarr, n);
+      throw;
+    }
+    for (size_type i = 0; i < size_; ++i) {
+      (arr_ + i)->~T();
+    }
+    Storage::Deallocate(arr_, capacity_);
+    arr_ = newarr;
+    capacity_ = n;
+  }
+
   size_t size_;
   size_t capacity_;
   T *arr_;
@@ -0,0 +1,192 @@
+#include "../s21_art_map.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename Map>
+std::vector<typename Map::key_type> Keys(const Map &m) {
+  std::vector<typename Map::key_type> keys;
+  for (const auto &entry : m) keys.push_back(entry.first);
+  return keys;
+}
+
+// Checks a against the std::map it should mirror, walking forwards and
+// then back.
+template <typename Key, typename T>
+void ExpectSame(const s21::art_map<Key, T> &a, const std::map<Key, T> &m) {
+  ASSERT_EQ(a.size(), m.size());
+  auto it = a.begin();
+  for (const auto &entry : m) {
+    ASSERT_EQ(it->first, entry.first);
+    ASSERT_EQ(it->second, entry.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == a.end());
+  for (auto back = m.rbegin(); back != m.rend(); ++back) {
+    --it;
+    ASSERT_EQ(it->first, back->first);
+  }
+}
+
+}  // namespace
+
+TEST(ArtMapTest, map_api) {
+  s21::art_map<int, std::string> a{{3, "c"}, {1, "a"}, {2, "b"}, {1, "z"}};
+  EXPECT_EQ(a.size(), 3u);
+  EXPECT_EQ(a.at(1), "a");
+  EXPECT_THROW(a.at(4), std::out_of_range);
+  EXPECT_FALSE(a.insert(2, "x").second);
+  EXPECT_FALSE(a.insert_or_assign(2, "x").second);
+  EXPECT_EQ(a[2], "x");
+  a[7] = "g";
+  EXPECT_TRUE(a.contains(7));
+  EXPECT_EQ(a.count(5), 0u);
+  EXPECT_EQ(a.find(5), a.end());
+  EXPECT_EQ(a.find(3)->second, "c");
+  EXPECT_EQ(Keys(a), (std::vector<int>{1, 2, 3, 7}));
+
+  auto next = a.erase(a.find(2));
+  EXPECT_EQ(next->first, 3);
+  EXPECT_EQ(a.erase(2), 0u);
+  EXPECT_EQ(a.erase(7), 1u);
+  EXPECT_EQ(Keys(a), (std::vector<int>{1, 3}));
+
+  s21::art_map<int, std::string> copy(a);
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.begin(), a.end());
+  EXPECT_EQ(Keys(copy), (std::vector<int>{1, 3}));
+  a = std::move(copy);
+  EXPECT_EQ(a.at(3), "c");
+  const auto &view = a;
+  EXPECT_EQ((--view.end())->first, 3);
+}
+
+TEST(ArtMapTest, signed_keys_keep_numeric_order) {
+  s21::art_map<int64_t, int> a;
+  std::vector<int64_t> keys = {0, -1, 1, INT64_MIN, INT64_MAX, -300, 300};
+  for (int64_t key : keys) a.insert(key, 0);
+  EXPECT_EQ(Keys(a), (std::vector<int64_t>{INT64_MIN, -300, -1, 0, 1, 300,
+                                           INT64_MAX}));
+  EXPECT_EQ(a.lower_bound(-2)->first, -1);
+  EXPECT_EQ(a.lower_bound(301)->first, INT64_MAX);
+}
+
+TEST(ArtMapTest, string_keys_that_prefix_each_other) {
+  s21::art_map<std::string, int> a;
+  std::map<std::string, int> m;
+  std::vector<std::string> keys = {"", "a", "ab", "abc", "abd", "b",
+                                   "abcdefghijkl", "abcdefghijkm",
+                                   "abcdefghij", "b\xff",
+                                   std::string("a\0b", 3)};
+  int n = 0;
+  for (const std::string &key : keys) {
+    a.insert(key, n);
+    m.emplace(key, n++);
+  }
+  ExpectSame(a, m);
+  EXPECT_EQ(a.lower_bound("abcc")->first, "abcdefghij");
+  EXPECT_EQ(a.lower_bound("abcdefghijl")->first, "abd");
+  EXPECT_EQ(a.lower_bound("c"), a.end());
+
+  // erasing the keys that other keys run through
+  for (const char *key : {"ab", "", "abcdefghij", "abc"}) {
+    EXPECT_EQ(a.erase(key), 1u);
+    m.erase(key);
+    ExpectSame(a, m);
+  }
+  EXPECT_EQ(a.at("abcdefghijkm"), 7);
+}
+
+TEST(ArtMapTest, prefix_range) {
+  s21::art_map<std::string, int> a;
+  for (const char *path : {"/api/users", "/api/users/7", "/api/orders",
+                           "/apix", "/static/app.js", "/"}) {
+    a.insert(path, 0);
+  }
+  auto range = a.prefix_range("/api/");
+  std::vector<std::string> found;
+  for (auto it = range.first; it != range.second; ++it) {
+    found.push_back(it->first);
+  }
+  EXPECT_EQ(found, (std::vector<std::string>{"/api/orders", "/api/users",
+                                             "/api/users/7"}));
+  range = a.prefix_range("/api/users/7");
+  EXPECT_EQ(range.first->first, "/api/users/7");
+  EXPECT_EQ(std::next(range.first), range.second);
+  range = a.prefix_range("/b");
+  EXPECT_EQ(range.first, range.second);
+  range = a.prefix_range("");
+  EXPECT_EQ(range.first, a.begin());
+  EXPECT_EQ(range.second, a.end());
+}
+
+// Random inserts and erases over dense and sparse keys run every node size
+// through growing and shrinking.
+TEST(ArtMapTest, matches_std_map) {
+  std::mt19937_64 random(49);
+  for (uint64_t spread : {uint64_t(300), uint64_t(1) << 20, ~uint64_t(0)}) {
+    s21::art_map<uint64_t, int> a;
+    std::map<uint64_t, int> m;
+    for (int step = 0; step < 20000; ++step) {
+      uint64_t key = random() % spread;
+      if (random() % 3) {
+        EXPECT_EQ(a.insert(key, step).second, m.emplace(key, step).second);
+      } else {
+        EXPECT_EQ(a.erase(key), m.erase(key));
+      }
+      if (step % 1000 == 0) ExpectSame(a, m);
+    }
+    ExpectSame(a, m);
+    for (int probe = 0; probe < 2000; ++probe) {
+      uint64_t key = random() % spread;
+      auto expected = m.lower_bound(key);
+      auto found = a.lower_bound(key);
+      if (expected == m.end()) {
+        EXPECT_EQ(found, a.end());
+      } else {
+        ASSERT_NE(found, a.end());
+        EXPECT_EQ(found->first, expected->first);
+      }
+      EXPECT_EQ(a.contains(key), m.count(key) == 1);
+    }
+    while (!m.empty()) {
+      EXPECT_EQ(a.erase(m.begin()->first), 1u);
+      m.erase(m.begin());
+    }
+    EXPECT_TRUE(a.empty());
+  }
+}
+
+TEST(ArtMapTest, matches_std_map_on_strings) {
+  std::mt19937 random(7);
+  const char alphabet[] = "ab/";
+  s21::art_map<std::string, int> a;
+  std::map<std::string, int> m;
+  for (int step = 0; step < 20000; ++step) {
+    std::string key(random() % 14, 'a');
+    for (char &c : key) c = alphabet[random() % 3];
+    if (random() % 3) {
+      EXPECT_EQ(a.insert(key, step).second, m.emplace(key, step).second);
+    } else {
+      EXPECT_EQ(a.erase(key), m.erase(key));
+    }
+    auto expected = m.lower_bound(key + "a");
+    auto found = a.lower_bound(key + "a");
+    if (expected == m.end()) {
+      EXPECT_EQ(found, a.end());
+    } else {
+      ASSERT_NE(found, a.end());
+      EXPECT_EQ(found->first, expected->first);
+    }
+  }
+  ExpectSame(a, m);
+}
@@ -0,0 +1,137 @@
+#include "../s21_bitset_set.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+template <typename Set>
+std::vector<int> Keys(const Set &s) {
+  std::vector<int> keys;
+  for (auto key : s) keys.push_back(static_cast<int>(key));
+  return keys;
+}
+
+}  // namespace
+
+TEST(BitsetSetTest, set_api) {
+  s21::bitset_set<int> s{5, 1, 200, 5};
+  EXPECT_EQ(s.size(), 3u);
+  EXPECT_EQ(Keys(s), (std::vector<int>{1, 5, 200}));
+  EXPECT_TRUE(s.insert(70).second);
+  EXPECT_FALSE(s.insert(70).second);
+  EXPECT_EQ(*s.insert(3).first, 3);
+  EXPECT_THROW(s.insert(-1), std::out_of_range);
+  EXPECT_FALSE(s.contains(-1));
+  EXPECT_FALSE(s.contains(100000));
+  EXPECT_EQ(s.count(200), 1u);
+  EXPECT_EQ(*s.find(5), 5);
+  EXPECT_EQ(s.find(6), s.end());
+  EXPECT_EQ(*s.lower_bound(6), 70);
+  EXPECT_EQ(*s.lower_bound(70), 70);
+  EXPECT_EQ(*s.upper_bound(70), 200);
+  EXPECT_EQ(*s.lower_bound(-10), 1);
+  EXPECT_EQ(s.lower_bound(201), s.end());
+  EXPECT_EQ(*--s.end(), 200);
+
+  s.erase(s.find(3));
+  EXPECT_EQ(s.erase(3), 0u);
+  EXPECT_EQ(s.erase(-3), 0u);
+  EXPECT_EQ(s.erase(200), 1u);
+  EXPECT_EQ(Keys(s), (std::vector<int>{1, 5, 70}));
+
+  s21::bitset_set<int> copy(s);
+  s.clear();
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.begin(), s.end());
+  EXPECT_EQ(copy.size(), 3u);
+  s.swap(copy);
+  EXPECT_EQ(Keys(s), (std::vector<int>{1, 5, 70}));
+  EXPECT_TRUE(copy.empty());
+}
+
+TEST(BitsetSetTest, set_operations) {
+  s21::bitset_set<uint16_t> a{1, 2, 3, 1000}, b{2, 3, 4, 60000};
+  s21::bitset_set<uint16_t> u = a, n = a, d = a;
+  u.unite(b);
+  n.intersect(b);
+  d.subtract(b);
+  EXPECT_EQ(Keys(u), (std::vector<int>{1, 2, 3, 4, 1000, 60000}));
+  EXPECT_EQ(u.size(), 6u);
+  EXPECT_EQ(Keys(n), (std::vector<int>{2, 3}));
+  EXPECT_EQ(n.size(), 2u);
+  EXPECT_EQ(Keys(d), (std::vector<int>{1, 1000}));
+  EXPECT_EQ(d.size(), 2u);
+
+  // merge keeps the keys both had in other, like s21::set
+  a.merge(b);
+  EXPECT_TRUE(a == u);
+  EXPECT_EQ(Keys(b), (std::vector<int>{2, 3}));
+  EXPECT_EQ(b.size(), 2u);
+
+  // equality ignores how much room each one has
+  s21::bitset_set<uint16_t> wide(65536);
+  wide.insert(2);
+  wide.insert(3);
+  EXPECT_TRUE(wide == b);
+  wide.insert(4);
+  EXPECT_TRUE(wide != b);
+  EXPECT_EQ(wide.max_size(), 65536u);
+}
+
+TEST(BitsetSetTest, keys_past_the_domain) {
+  s21::bitset_set<uint64_t> s{0, 7};
+  EXPECT_EQ(s.max_size(), uint64_t(1) << 40);
+  EXPECT_THROW(s.insert(UINT64_MAX), std::out_of_range);
+  EXPECT_FALSE(s.contains(UINT64_MAX));
+  EXPECT_EQ(s.find(UINT64_MAX), s.end());
+  EXPECT_EQ(s.erase(UINT64_MAX), 0u);
+  EXPECT_EQ(s.lower_bound(UINT64_MAX), s.end());
+  EXPECT_EQ(s.upper_bound(UINT64_MAX), s.end());
+  EXPECT_EQ(s.lower_bound(UINT64_MAX - 1), s.end());
+  EXPECT_EQ(Keys(s), (std::vector<int>{0, 7}));
+
+  // far too large to hold a bit for: refused before anything is allocated
+  EXPECT_THROW(s.insert(UINT64_MAX - 1), std::out_of_range);
+  EXPECT_THROW(s.insert(s.max_size()), std::out_of_range);
+  EXPECT_FALSE(s.contains(s.max_size()));
+  EXPECT_EQ(s.lower_bound(s.max_size()), s.end());
+  EXPECT_EQ(s.size(), 2u);
+  EXPECT_EQ(s.bits().size(), 8u);
+
+  s21::bitset_set<int64_t> wide{5};
+  EXPECT_THROW(wide.insert(INT64_MAX), std::out_of_range);
+  EXPECT_EQ(wide.max_size(), uint64_t(1) << 40);
+  EXPECT_EQ(s21::bitset_set<int>().max_size(), uint64_t(1) << 31);
+}
+
+TEST(BitsetSetTest, matches_std_set) {
+  std::mt19937 random(50);
+  s21::bitset_set<int> s;
+  std::set<int> expected;
+  for (int step = 0; step < 20000; ++step) {
+    int key = random() % 5000;
+    if (random() % 3) {
+      EXPECT_EQ(s.insert(key).second, expected.insert(key).second);
+    } else {
+      EXPECT_EQ(s.erase(key), expected.erase(key));
+    }
+    auto want = expected.upper_bound(key);
+    auto got = s.upper_bound(key);
+    if (want == expected.end()) {
+      EXPECT_EQ(got, s.end());
+    } else {
+      EXPECT_EQ(*got, *want);
+    }
+  }
+  EXPECT_EQ(s.size(), expected.size());
+  EXPECT_EQ(Keys(s), std::vector<int>(expected.begin(), expected.end()));
+  std::vector<int> backwards;
+  for (auto it = s.end(); it != s.begin();) backwards.push_back(*--it);
+  EXPECT_EQ(backwards, std::vector<int>(expected.rbegin(), expected.rend()));
+}
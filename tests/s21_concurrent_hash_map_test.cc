@@ -0,0 +1,117 @@
+#include "../s21_concurrent_hash_map.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Sends every key to the same stripe and slot, so all of them share one
+// probe run.
+struct ConstantHash {
+  size_t operator()(int) const { return 7; }
+};
+
+}  // namespace
+
+TEST(ConcurrentHashMapTest, single_thread_operations) {
+  s21::ConcurrentHashMap<std::string, int> map(5);
+  EXPECT_EQ(map.stripe_count(), 8u);
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert("a", 1));
+  EXPECT_FALSE(map.insert("a", 2));
+  EXPECT_TRUE(map.insert_or_assign("b", 2));
+  EXPECT_FALSE(map.insert_or_assign("b", 3));
+  EXPECT_TRUE(map.update("c", [](int &count) { count += 5; }));
+  EXPECT_FALSE(map.update("c", [](int &count) { count += 5; }));
+  int value = 0;
+  EXPECT_TRUE(map.get("c", value));
+  EXPECT_EQ(value, 10);
+  EXPECT_TRUE(map.get("b", value));
+  EXPECT_EQ(value, 3);
+  EXPECT_FALSE(map.get("d", value));
+  EXPECT_EQ(map.size(), 3u);
+  EXPECT_TRUE(map.erase("a"));
+  EXPECT_FALSE(map.erase("a"));
+  EXPECT_FALSE(map.contains("a"));
+  int sum = 0;
+  map.for_each([&sum](const std::string &, int &v) { sum += v; });
+  EXPECT_EQ(sum, 13);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.contains("b"));
+}
+
+TEST(ConcurrentHashMapTest, matches_unordered_map) {
+  s21::ConcurrentHashMap<int, int> map(4);
+  std::unordered_map<int, int> ref;
+  std::mt19937 gen(47);
+  for (int step = 0; step < 50000; ++step) {
+    int key = gen() % 2000;
+    switch (gen() % 4) {
+      case 0:
+        EXPECT_EQ(map.insert(key, step), ref.insert({key, step}).second);
+        break;
+      case 1:
+        EXPECT_EQ(map.insert_or_assign(key, step),
+                  ref.insert_or_assign(key, step).second);
+        break;
+      case 2:
+        EXPECT_EQ(map.erase(key), ref.erase(key) == 1);
+        break;
+      default:
+        map.update(key, [](int &v) { ++v; });
+        ++ref[key];
+    }
+  }
+  ASSERT_EQ(map.size(), ref.size());
+  for (const auto &entry : ref) {
+    int value = 0;
+    ASSERT_TRUE(map.get(entry.first, value));
+    EXPECT_EQ(value, entry.second);
+  }
+}
+
+TEST(ConcurrentHashMapTest, erase_inside_one_probe_run) {
+  s21::ConcurrentHashMap<int, int, ConstantHash> map(1);
+  for (int i = 0; i < 40; ++i) map.insert(i, i);
+  for (int i = 0; i < 40; i += 3) EXPECT_TRUE(map.erase(i));
+  for (int i = 0; i < 40; ++i) {
+    int value = -1;
+    EXPECT_EQ(map.get(i, value), i % 3 != 0);
+    if (i % 3) {
+      EXPECT_EQ(value, i);
+    }
+  }
+  EXPECT_EQ(map.size(), 26u);
+}
+
+TEST(ConcurrentHashMapTest, concurrent_counters) {
+  s21::ConcurrentHashMap<int, long> counters(16);
+  const int kThreads = 4, kKeys = 300, kRounds = 20;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&counters, t] {
+      for (int round = 0; round < kRounds; ++round) {
+        for (int key = 0; key < kKeys; ++key) {
+          counters.update(key, [](long &count) { ++count; });
+          // private keys force the stripes to grow while others count
+          counters.insert_or_assign(100000 * (t + 1) + round * kKeys + key,
+                                    key);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(counters.size(),
+            static_cast<size_t>(kKeys + kThreads * kRounds * kKeys));
+  for (int key = 0; key < kKeys; ++key) {
+    long count = 0;
+    ASSERT_TRUE(counters.get(key, count));
+    EXPECT_EQ(count, kThreads * kRounds);
+  }
+}
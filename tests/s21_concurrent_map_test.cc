@@ -0,0 +1,79 @@
+#include "../s21_concurrent_map.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(ConcurrentMapTest, single_thread_operations) {
+  s21::ConcurrentMap<std::string, int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert("a", 1));
+  EXPECT_FALSE(map.insert("a", 2));
+  EXPECT_TRUE(map.insert_or_assign("b", 2));
+  EXPECT_FALSE(map.insert_or_assign("a", 3));
+  int value = 0;
+  EXPECT_TRUE(map.get("a", value));
+  EXPECT_EQ(value, 3);
+  EXPECT_FALSE(map.get("c", value));
+  EXPECT_TRUE(map.visit("b", [](const int &found) { EXPECT_EQ(found, 2); }));
+  EXPECT_EQ(map.size(), 2u);
+
+  auto before = map.snapshot();
+  EXPECT_TRUE(map.erase("a"));
+  EXPECT_FALSE(map.erase("a"));
+  EXPECT_FALSE(map.contains("a"));
+  EXPECT_EQ(before.at("a"), 3);
+  EXPECT_EQ(before.size(), 2u);
+
+  map.update([](const auto &current) {
+    return current.insert("x", 10).insert("y", 20).erase("b");
+  });
+  EXPECT_EQ(map.size(), 2u);
+  EXPECT_TRUE(map.contains("y"));
+  map.clear();
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(ConcurrentMapTest, readers_see_whole_versions) {
+  // every published version holds keys 0..99 with one shared value, so a
+  // reader mixing two versions would see different values
+  s21::ConcurrentMap<int, int> map;
+  map.update([](const auto &current) {
+    auto next = current;
+    for (int key = 0; key < 100; ++key) next = next.insert(key, 0);
+    return next;
+  });
+  std::atomic<bool> done{false};
+  std::atomic<int> torn{0};
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 3; ++r) {
+    readers.emplace_back([&] {
+      while (!done.load()) {
+        auto snap = map.snapshot();
+        int first = snap.at(0);
+        for (const auto &entry : snap) torn += entry.second != first;
+        int value = -1;
+        map.get(50, value);
+        torn += value < first;
+      }
+    });
+  }
+  for (int round = 1; round <= 200; ++round) {
+    map.update([round](const auto &current) {
+      auto next = current;
+      for (int key = 0; key < 100; ++key) {
+        next = next.insert_or_assign(key, round);
+      }
+      return next;
+    });
+  }
+  done = true;
+  for (auto &reader : readers) reader.join();
+  EXPECT_EQ(torn.load(), 0);
+  int value = 0;
+  EXPECT_TRUE(map.get(99, value));
+  EXPECT_EQ(value, 200);
+}
@@ -0,0 +1,108 @@
+#include "../s21_concurrent_skip_list_map.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(ConcurrentSkipListMapTest, map_api) {
+  s21::ConcurrentSkipListMap<std::string, int> map;
+  EXPECT_TRUE(map.empty());
+  auto added = map.insert("b", 2);
+  EXPECT_TRUE(added.second);
+  EXPECT_EQ(added.first->first, "b");
+  EXPECT_TRUE(map.insert({"a", 1}).second);
+  auto again = map.insert("a", 10);
+  EXPECT_FALSE(again.second);
+  EXPECT_EQ(again.first->second, 1);
+  map.insert("c", 3);
+  EXPECT_EQ(map.size(), 3u);
+  EXPECT_EQ(map.at("c"), 3);
+  EXPECT_THROW(map.at("z"), std::out_of_range);
+  EXPECT_TRUE(map.contains("b"));
+  EXPECT_EQ(map.count("q"), 0u);
+  EXPECT_EQ(map.lower_bound("bb")->first, "c");
+  EXPECT_EQ(map.lower_bound("d"), map.end());
+
+  std::string keys;
+  for (const auto &entry : map) keys += entry.first;
+  EXPECT_EQ(keys, "abc");
+  EXPECT_EQ(map.erase("b"), 1u);
+  EXPECT_EQ(map.erase("b"), 0u);
+  EXPECT_EQ(map.find("b"), map.end());
+  int value = 0;
+  EXPECT_FALSE(map.get("b", value));
+  EXPECT_TRUE(map.get("a", value));
+  EXPECT_EQ(value, 1);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(ConcurrentSkipListMapTest, matches_std_map) {
+  s21::ConcurrentSkipListMap<int, int> map;
+  std::map<int, int> ref;
+  std::mt19937 gen(48);
+  for (int step = 0; step < 20000; ++step) {
+    int key = gen() % 1000;
+    if (gen() % 3 == 0) {
+      EXPECT_EQ(map.erase(key), ref.erase(key));
+    } else {
+      EXPECT_EQ(map.insert(key, step).second,
+                ref.insert({key, step}).second);
+    }
+  }
+  ASSERT_EQ(map.size(), ref.size());
+  auto it = ref.begin();
+  for (const auto &entry : map) {
+    ASSERT_NE(it, ref.end());
+    EXPECT_EQ(entry.first, it->first);
+    EXPECT_EQ(entry.second, it->second);
+    ++it;
+  }
+  EXPECT_EQ(it, ref.end());
+}
+
+TEST(ConcurrentSkipListMapTest, concurrent_inserts_and_erases) {
+  s21::ConcurrentSkipListMap<int, int> map;
+  const int kThreads = 4, kKeys = 2000;
+  std::atomic<int> inserted{0}, erased{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      std::mt19937 gen(t);
+      // every thread fights over the same keys
+      for (int i = 0; i < 3 * kKeys; ++i) {
+        int key = gen() % kKeys;
+        if (gen() % 2) {
+          inserted += map.insert(key, key).second;
+        } else {
+          erased += static_cast<int>(map.erase(key));
+        }
+      }
+      // and finally owns a range of its own
+      for (int key = kKeys * (t + 1); key < kKeys * (t + 2); ++key) {
+        inserted += map.insert(key, key).second;
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(map.size(), static_cast<size_t>(inserted - erased));
+  size_t seen = 0;
+  int last = -1;
+  for (const auto &entry : map) {
+    EXPECT_LT(last, entry.first);
+    EXPECT_EQ(entry.first, entry.second);
+    last = entry.first;
+    ++seen;
+  }
+  EXPECT_EQ(seen, map.size());
+  for (int key = kKeys; key < kKeys * (kThreads + 1); ++key) {
+    EXPECT_TRUE(map.contains(key));
+  }
+}
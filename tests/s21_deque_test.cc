@@ -0,0 +1,91 @@
+#include "../s21_deque.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <string>
+
+TEST(DequeTest, push_and_pop_both_ends) {
+  s21::Deque<int> d;
+  std::deque<int> expected;
+  for (int i = 0; i < 5000; ++i) {
+    if (i % 3 == 0) {
+      d.push_front(i);
+      expected.push_front(i);
+    } else {
+      d.push_back(i);
+      expected.push_back(i);
+    }
+  }
+  ASSERT_EQ(d.size(), expected.size());
+  for (size_t i = 0; i < d.size(); ++i) EXPECT_EQ(d[i], expected[i]);
+  EXPECT_EQ(d.front(), expected.front());
+  EXPECT_EQ(d.back(), expected.back());
+  while (d.size() > 10) {
+    d.pop_front();
+    d.pop_back();
+    expected.pop_front();
+    expected.pop_back();
+  }
+  EXPECT_TRUE(std::equal(d.begin(), d.end(), expected.begin()));
+  d.clear();
+  EXPECT_TRUE(d.empty());
+  d.push_front(7);
+  EXPECT_EQ(d.back(), 7);
+}
+
+TEST(DequeTest, references_survive_growth) {
+  s21::Deque<std::string> d = {"middle"};
+  std::string* middle = &d.front();
+  for (int i = 0; i < 10000; ++i) {
+    d.push_back("back");
+    d.push_front("front");
+  }
+  EXPECT_EQ(middle, &d[10000]);
+  EXPECT_EQ(*middle, "middle");
+}
+
+TEST(DequeTest, queue_pattern_reuses_map) {
+  s21::Deque<int> d;
+  long sum = 0;
+  for (int i = 0; i < 100000; ++i) {
+    d.push_back(i);
+    if (d.size() > 100) {
+      sum += d.front();
+      d.pop_front();
+    }
+  }
+  EXPECT_EQ(d.size(), 100u);
+  EXPECT_EQ(d.front(), 99900);
+  EXPECT_EQ(sum, 99899L * 99900 / 2);
+}
+
+TEST(DequeTest, random_access_iterators) {
+  s21::Deque<int> d;
+  for (int i = 0; i < 300; ++i) d.push_front(i * 7 % 300);
+  std::sort(d.begin(), d.end());
+  for (int i = 0; i < 300; ++i) EXPECT_EQ(d[i], i);
+  const s21::Deque<int>& cd = d;
+  s21::Deque<int>::const_iterator it = d.begin();
+  EXPECT_TRUE(it == cd.begin());
+  EXPECT_EQ(cd.end() - cd.begin(), 300);
+  EXPECT_EQ(*(cd.begin() + 42), 42);
+  EXPECT_EQ(cd.begin()[299], 299);
+  EXPECT_THROW(d.at(300), std::out_of_range);
+}
+
+TEST(DequeTest, copy_move_insert_many) {
+  s21::Deque<int> d = {3, 4};
+  d.insert_many_front(1, 2);
+  d.insert_many_back(5, 6);
+  s21::Deque<int> copy(d);
+  for (int i = 0; i < 6; ++i) EXPECT_EQ(copy[i], i + 1);
+  s21::Deque<int> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 6u);
+  copy = moved;
+  EXPECT_EQ(copy.back(), 6);
+  d = std::move(moved);
+  EXPECT_EQ(d.at(5), 6);
+}
@@ -0,0 +1,115 @@
+#include "../s21_dynamic_bitset.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+std::vector<size_t> SetBits(const s21::dynamic_bitset &bits) {
+  std::vector<size_t> found;
+  for (size_t pos = bits.find_first(); pos != s21::dynamic_bitset::npos;
+       pos = bits.find_next(pos)) {
+    found.push_back(pos);
+  }
+  return found;
+}
+
+}  // namespace
+
+TEST(DynamicBitsetTest, single_bits) {
+  s21::dynamic_bitset bits(130);
+  EXPECT_EQ(bits.size(), 130u);
+  EXPECT_TRUE(bits.none());
+  bits.set(0).set(63).set(64).set(129);
+  bits.flip(5).flip(5).flip(100);
+  bits.reset(64);
+  EXPECT_TRUE(bits.test(63));
+  EXPECT_FALSE(bits.test(64));
+  EXPECT_TRUE(bits[100]);
+  EXPECT_EQ(bits.count(), 4u);
+  EXPECT_THROW(bits.test(130), std::out_of_range);
+  EXPECT_THROW(bits.set(130), std::out_of_range);
+
+  bits.flip();
+  EXPECT_EQ(bits.count(), 126u);
+  bits.set();
+  EXPECT_TRUE(bits.all());
+  bits.resize(70);
+  EXPECT_EQ(bits.count(), 70u);
+  bits.resize(200);
+  EXPECT_EQ(bits.count(), 70u);
+  EXPECT_FALSE(bits.test(150));
+  bits.reset();
+  EXPECT_FALSE(bits.any());
+}
+
+TEST(DynamicBitsetTest, find_walks_both_ways) {
+  s21::dynamic_bitset bits(300);
+  std::vector<size_t> expected = {0, 1, 63, 64, 65, 127, 128, 200, 299};
+  for (size_t pos : expected) bits.set(pos);
+  EXPECT_EQ(SetBits(bits), expected);
+  EXPECT_EQ(bits.find_next(299), s21::dynamic_bitset::npos);
+  EXPECT_EQ(bits.find_next(1000), s21::dynamic_bitset::npos);
+
+  std::vector<size_t> backwards;
+  for (size_t pos = bits.find_last(); pos != s21::dynamic_bitset::npos;
+       pos = bits.find_prev(pos)) {
+    backwards.insert(backwards.begin(), pos);
+  }
+  EXPECT_EQ(backwards, expected);
+  EXPECT_EQ(bits.find_prev(1000), 299u);
+  EXPECT_EQ(bits.find_prev(64), 63u);
+
+  s21::dynamic_bitset empty(128);
+  EXPECT_EQ(empty.find_first(), s21::dynamic_bitset::npos);
+  EXPECT_EQ(empty.find_last(), s21::dynamic_bitset::npos);
+  EXPECT_EQ(s21::dynamic_bitset().find_first(), s21::dynamic_bitset::npos);
+}
+
+TEST(DynamicBitsetTest, set_operations_match_bool_vectors) {
+  std::mt19937 random(50);
+  for (int round = 0; round < 50; ++round) {
+    size_t na = random() % 300, nb = random() % 300;
+    s21::dynamic_bitset a(na), b(nb);
+    std::vector<bool> va(na), vb(nb);
+    for (size_t i = 0; i < na; ++i) {
+      if (random() % 2) {
+        a.set(i);
+        va[i] = true;
+      }
+    }
+    for (size_t i = 0; i < nb; ++i) {
+      if (random() % 2) {
+        b.set(i);
+        vb[i] = true;
+      }
+    }
+    auto bit = [](const std::vector<bool> &v, size_t i) {
+      return i < v.size() && v[i];
+    };
+    s21::dynamic_bitset u = a | b, n = a & b, x = a ^ b, d = a - b;
+    EXPECT_EQ(u.size(), std::max(na, nb));
+    EXPECT_EQ(x.size(), std::max(na, nb));
+    EXPECT_EQ(n.size(), na);
+    EXPECT_EQ(d.size(), na);
+    bool subset = true, meet = false;
+    for (size_t i = 0; i < std::max(na, nb); ++i) {
+      bool in_a = bit(va, i), in_b = bit(vb, i);
+      EXPECT_EQ(u[i], in_a || in_b);
+      EXPECT_EQ(x[i], in_a != in_b);
+      if (i < na) {
+        EXPECT_EQ(n[i], in_a && in_b);
+        EXPECT_EQ(d[i], in_a && !in_b);
+      }
+      subset &= !in_a || in_b;
+      meet |= in_a && in_b;
+    }
+    EXPECT_EQ(a.is_subset_of(b), subset);
+    EXPECT_EQ(a.intersects(b), meet);
+    EXPECT_EQ(u.count(), n.count() + x.count());
+  }
+}
@@ -0,0 +1,132 @@
+#include "../s21_interval_tree.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Reservation {
+  int low;
+  int high;
+  int id;
+};
+
+}  // namespace
+
+TEST(IntervalTreeTest, overlapping_and_containing) {
+  s21::IntervalTree<int, std::string> rooms;
+  rooms.insert(10, 20, "a");
+  rooms.insert(15, 25, "b");
+  rooms.insert(30, 40, "c");
+  rooms.insert(5, 12, "d");
+  EXPECT_EQ(rooms.size(), 4u);
+
+  auto found = rooms.overlapping(12, 16);
+  ASSERT_EQ(found.size(), 2u);
+  EXPECT_EQ(found[0].value, "a");
+  EXPECT_EQ(found[1].value, "b");
+  // half-open: [5, 12) ends where the query starts, [30, 40) starts where
+  // it ends
+  EXPECT_EQ(rooms.overlapping(25, 30).size(), 0u);
+  EXPECT_FALSE(rooms.overlaps(25, 30));
+  EXPECT_TRUE(rooms.overlaps(24, 26));
+
+  found = rooms.containing(10);
+  ASSERT_EQ(found.size(), 2u);
+  EXPECT_EQ(found[0].value, "d");
+  EXPECT_EQ(found[1].value, "a");
+  EXPECT_EQ(rooms.containing(20).size(), 1u);
+  EXPECT_EQ(rooms.containing(40).size(), 0u);
+}
+
+TEST(IntervalTreeTest, ordered_iteration_find_and_erase) {
+  s21::IntervalTree<int, int> tree;
+  tree.insert(3, 9, 1);
+  tree.insert(1, 4, 2);
+  tree.insert(3, 5, 3);
+  tree.insert(3, 9, 4);
+  std::vector<int> order;
+  for (const auto &entry : tree) order.push_back(entry.value);
+  EXPECT_EQ(order, (std::vector<int>{2, 3, 1, 4}));
+
+  auto it = tree.find(3, 9);
+  ASSERT_NE(it, tree.end());
+  EXPECT_EQ(it->value, 1);
+  EXPECT_EQ(tree.find(3, 8), tree.end());
+  it->value = 10;
+  it = tree.erase(it);
+  EXPECT_EQ(it->value, 4);
+  EXPECT_EQ(tree.find(3, 9)->value, 4);
+  EXPECT_EQ((--tree.end())->value, 4);
+  EXPECT_EQ(tree.size(), 3u);
+  EXPECT_THROW(tree.insert(5, 5, 0), std::invalid_argument);
+  EXPECT_THROW(tree.insert(6, 2, 0), std::invalid_argument);
+}
+
+TEST(IntervalTreeTest, visitor_can_stop_early) {
+  s21::IntervalTree<int, int> tree;
+  for (int i = 0; i < 100; ++i) tree.insert(i, i + 10, i);
+  int seen = 0;
+  size_t visited = tree.visit_containing(50, [&seen](auto &entry) {
+    seen += entry.value;
+    return entry.value < 43;
+  });
+  EXPECT_EQ(visited, 3u);
+  EXPECT_EQ(seen, 41 + 42 + 43);
+  visited = tree.visit_overlapping(
+      0, 1000, [](auto &entry) { entry.value = -entry.value; });
+  EXPECT_EQ(visited, 100u);
+  EXPECT_EQ(tree.begin()->value, 0);
+  EXPECT_EQ((++tree.begin())->value, -1);
+}
+
+TEST(IntervalTreeTest, matches_brute_force) {
+  std::mt19937 gen(44);
+  s21::IntervalTree<int, int> tree;
+  std::vector<Reservation> all;
+  std::vector<s21::IntervalTree<int, int>::iterator> handles;
+  for (int step = 0; step < 4000; ++step) {
+    if (!all.empty() && gen() % 3 == 0) {
+      size_t i = gen() % all.size();
+      tree.erase(handles[i]);
+      all[i] = all.back();
+      all.pop_back();
+      handles[i] = handles.back();
+      handles.pop_back();
+    } else {
+      int low = gen() % 10000;
+      int high = low + 1 + gen() % (gen() % 8 ? 50 : 3000);
+      handles.push_back(tree.insert(low, high, step));
+      all.push_back({low, high, step});
+    }
+    if (step % 50) continue;
+    int a = gen() % 10000;
+    int b = a + 1 + gen() % 200;
+    size_t expected = 0, containing = 0;
+    for (const auto &r : all) {
+      expected += r.low < b && a < r.high;
+      containing += r.low <= a && a < r.high;
+    }
+    int last_low = -1;
+    size_t got = tree.visit_overlapping(a, b, [&](auto &entry) {
+      EXPECT_TRUE(entry.low < b && a < entry.high);
+      EXPECT_LE(last_low, entry.low);
+      last_low = entry.low;
+    });
+    EXPECT_EQ(got, expected);
+    EXPECT_EQ(tree.containing(a).size(), containing);
+    EXPECT_EQ(tree.overlaps(a, b), expected > 0);
+  }
+  EXPECT_EQ(tree.size(), all.size());
+  s21::IntervalTree<int, int> moved(std::move(tree));
+  EXPECT_TRUE(tree.empty());
+  EXPECT_EQ(moved.size(), all.size());
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  EXPECT_EQ(moved.begin(), moved.end());
+}
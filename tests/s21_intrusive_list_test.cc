@@ -0,0 +1,69 @@
+#include "../s21_intrusive_list.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace {
+struct Job {
+  explicit Job(int job_id) : id(job_id) {}
+  int id;
+  std::string name;
+  s21::ListHook hook;
+  s21::ListHook other;
+};
+
+using JobList = s21::IntrusiveList<Job, &Job::hook>;
+}  // namespace
+
+TEST(IntrusiveListTest, push_and_pop) {
+  Job a(1), b(2), c(3);
+  JobList l;
+  EXPECT_TRUE(l.empty());
+  l.push_back(b);
+  l.push_back(c);
+  l.push_front(a);
+  EXPECT_EQ(l.size(), 3u);
+  EXPECT_EQ(&l.front(), &a);
+  EXPECT_EQ(&l.back(), &c);
+  int expected = 1;
+  for (auto it = l.begin(); it != l.end(); ++it) EXPECT_EQ(it->id, expected++);
+  EXPECT_EQ((--l.end())->id, 3);
+
+  l.pop_front();
+  EXPECT_FALSE(a.hook.is_linked());
+  l.pop_back();
+  EXPECT_EQ(l.size(), 1u);
+  EXPECT_EQ(&l.front(), &b);
+}
+
+TEST(IntrusiveListTest, remove_by_reference) {
+  Job jobs[] = {Job(0), Job(1), Job(2), Job(3)};
+  JobList l;
+  for (auto& job : jobs) l.push_back(job);
+  l.remove(jobs[2]);
+  l.remove(jobs[0]);
+  EXPECT_EQ(l.size(), 2u);
+  EXPECT_EQ(l.front().id, 1);
+  EXPECT_EQ(l.back().id, 3);
+  EXPECT_TRUE(l.begin() != l.end());
+  auto it = l.erase(l.iterator_to(jobs[1]));
+  EXPECT_EQ(&*it, &jobs[3]);
+}
+
+TEST(IntrusiveListTest, element_in_two_lists) {
+  Job a(1), b(2);
+  JobList l;
+  s21::IntrusiveList<Job, &Job::other> reversed;
+  l.push_back(a);
+  l.push_back(b);
+  reversed.push_front(a);
+  reversed.push_front(b);
+  EXPECT_EQ(l.front().id, 1);
+  EXPECT_EQ(reversed.front().id, 2);
+  l.clear();
+  EXPECT_TRUE(l.empty());
+  EXPECT_FALSE(a.hook.is_linked());
+  EXPECT_TRUE(a.other.is_linked());
+  EXPECT_EQ(reversed.size(), 2u);
+}
@@ -0,0 +1,103 @@
+#include "../s21_intrusive_set.h"
+
+#include <gtest/gtest.h>
+
+#include "../s21_vector.h"
+
+namespace {
+struct Timer {
+  explicit Timer(int when) : deadline(when) {}
+  int deadline;
+  s21::RbHook hook;
+};
+
+struct ByDeadline {
+  bool operator()(const Timer& a, const Timer& b) const {
+    return a.deadline < b.deadline;
+  }
+};
+
+using TimerSet = s21::IntrusiveSet<Timer, &Timer::hook, ByDeadline>;
+
+// Black height of the subtree, or -1 when an invariant is broken.
+int BlackHeight(const s21::RbHook* node) {
+  if (!node) return 1;
+  if (!node->isBlack) {
+    for (auto* child : {node->leftChild, node->rightChild}) {
+      if (child && !child->isBlack) return -1;
+    }
+  }
+  for (auto* child : {node->leftChild, node->rightChild}) {
+    if (child && child->parent != node) return -1;
+  }
+  int left = BlackHeight(node->leftChild);
+  int right = BlackHeight(node->rightChild);
+  if (left < 0 || left != right) return -1;
+  return left + node->isBlack;
+}
+
+int CheckedHeight(TimerSet& s) {
+  if (s.empty()) return 1;
+  auto* root = &s.begin()->hook;
+  while (root->parent) root = root->parent;
+  return root->isBlack ? BlackHeight(root) : -1;
+}
+}  // namespace
+
+TEST(IntrusiveSetTest, insert_orders_and_rejects_duplicates) {
+  s21::Vector<Timer> timers;
+  for (int i = 0; i < 500; ++i) timers.push_back(Timer(i * 37 % 500));
+  TimerSet s;
+  for (auto& t : timers) EXPECT_TRUE(s.insert(t).second);
+  EXPECT_EQ(s.size(), 500u);
+  EXPECT_GT(CheckedHeight(s), 0);
+
+  Timer twin(42);
+  auto result = s.insert(twin);
+  EXPECT_FALSE(result.second);
+  EXPECT_NE(&*result.first, &twin);
+  EXPECT_EQ(result.first->deadline, 42);
+
+  int expected = 0;
+  for (auto& t : s) EXPECT_EQ(t.deadline, expected++);
+  EXPECT_EQ((--s.end())->deadline, 499);
+}
+
+TEST(IntrusiveSetTest, remove_by_reference) {
+  s21::Vector<Timer> timers;
+  for (int i = 0; i < 1000; ++i) timers.push_back(Timer(i));
+  TimerSet s;
+  for (auto& t : timers) s.insert(t);
+  s21::Vector<bool> removed(1000);
+  for (int i = 0; i < 1000; i += 3) {
+    s.remove(timers[i * 7 % 1000]);
+    removed[i * 7 % 1000] = true;
+  }
+  EXPECT_GT(CheckedHeight(s), 0);
+  for (int i = 0; i < 1000; ++i) EXPECT_NE(s.contains(Timer(i)), removed[i]);
+  while (!s.empty()) {
+    s.erase(s.begin());
+    ASSERT_GT(CheckedHeight(s), 0);
+  }
+  EXPECT_TRUE(s.begin() == s.end());
+}
+
+TEST(IntrusiveSetTest, find_and_bounds) {
+  Timer a(10), b(20), c(30);
+  TimerSet s;
+  s.insert(b);
+  s.insert(a);
+  s.insert(c);
+  EXPECT_EQ(&*s.find(Timer(20)), &b);
+  EXPECT_TRUE(s.find(Timer(25)) == s.end());
+  EXPECT_EQ(&*s.lower_bound(Timer(25)), &c);
+  EXPECT_TRUE(s.lower_bound(Timer(31)) == s.end());
+  EXPECT_EQ(s.erase(Timer(10)), 1u);
+  EXPECT_EQ(s.erase(Timer(10)), 0u);
+  EXPECT_EQ(&*s.iterator_to(c), &c);
+  s.clear();
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(b.hook.parent, nullptr);
+  s.insert(c);
+  EXPECT_EQ(s.size(), 1u);
+}
@@ -4,6 +4,7 @@
 
 #include <iostream>
 #include <list>
+#include <string>
 
 namespace s21 {
 
@@ -41,7 +42,7 @@ TEST(List, Empty) {
   EXPECT_EQ(a.size(), b.size());
 
   b.pop_back();
-  EXPECT_EQ(0, b.back());
+  EXPECT_TRUE(b.begin() == b.end());
 }
 
 TEST(List, ElementAccess) {
@@ -55,12 +56,11 @@ TEST(List, ElementAccess) {
   c.clear();
   b.clear();
   EXPECT_EQ(c.empty(), b.empty());
-  EXPECT_EQ(b.front(), c.front());
-
-  std::list<int> b1;
-  List<int> c2;
+  EXPECT_TRUE(c.begin() == c.end());
 
-  EXPECT_EQ(b1.back(), c2.front());
+  List<std::string> s = {"sentinel", "holds", "no", "value"};
+  EXPECT_EQ(s.front(), "sentinel");
+  EXPECT_EQ(s.back(), "value");
 }
 
 TEST(List, Iterator) {
@@ -74,14 +74,13 @@ TEST(List, Iterator) {
   }
 
   EXPECT_EQ(*(c.begin()), *b.begin());
-  EXPECT_EQ(*(c.end()), *c.end());
+  EXPECT_EQ(*--c.end(), *--b.end());
 
   while (!c.empty()) {
     c.pop_front();
   }
   b.clear();
-  EXPECT_EQ(*(c.begin()), *b.begin());
-  EXPECT_EQ(*(c.end()), *c.end());
+  EXPECT_TRUE(c.begin() == c.end());
 }
 
 TEST(List, Clear) {
@@ -119,10 +118,7 @@ TEST(List, InsertAndErase) {
     c.erase(c.begin());
   }
   EXPECT_EQ(c.empty(), 1);
-  EXPECT_EQ(c.front(), 0);
-  EXPECT_EQ(c.back(), 0);
-  EXPECT_EQ(*c.end(), 0);
-  EXPECT_EQ(*c.begin(), 0);
+  EXPECT_TRUE(c.begin() == c.end());
 
   for (int i = 4; i > 0; --i) {
     it = c.insert(c.end(), i);
@@ -138,10 +134,7 @@ TEST(List, InsertAndErase) {
     c.erase(c.begin());
   }
   EXPECT_EQ(c.empty(), 1);
-  EXPECT_EQ(c.front(), 0);
-  EXPECT_EQ(c.back(), 0);
-  EXPECT_EQ(*c.end(), 0);
-  EXPECT_EQ(*c.begin(), 0);
+  EXPECT_TRUE(c.begin() == c.end());
 }
 
 TEST(List, PushAndPop) {
@@ -158,10 +151,7 @@ TEST(List, PushAndPop) {
     c.pop_front();
   }
   EXPECT_EQ(c.empty(), 1);
-  EXPECT_EQ(c.front(), 0);
-  EXPECT_EQ(c.back(), 0);
-  EXPECT_EQ(*c.end(), 0);
-  EXPECT_EQ(*c.begin(), 0);
+  EXPECT_TRUE(c.begin() == c.end());
 
   b.push_back(5);
   b.push_front(0);
@@ -170,16 +160,13 @@ TEST(List, PushAndPop) {
   }
   EXPECT_EQ((c == b), 1);
   EXPECT_EQ(c.size(), 6);
-  EXPECT_EQ(*c.end(), 6);
+  EXPECT_EQ(c.back(), 5);
 
   for (auto it = b.begin(); it != b.end(); ++it) {
     c.pop_back();
   }
   EXPECT_EQ(c.empty(), 1);
-  EXPECT_EQ(c.front(), 0);
-  EXPECT_EQ(c.back(), 0);
-  EXPECT_EQ(*c.end(), 0);
-  EXPECT_EQ(*c.begin(), 0);
+  EXPECT_TRUE(c.begin() == c.end());
 
   b.pop_back();
   b.pop_front();
@@ -188,7 +175,7 @@ TEST(List, PushAndPop) {
   }
   EXPECT_EQ((c == b), 1);
   EXPECT_EQ(c.size(), 4);
-  EXPECT_EQ(*c.end(), 4);
+  EXPECT_EQ(c.back(), 4);
 }
 
 TEST(List, Swap) {
@@ -197,10 +184,7 @@ TEST(List, Swap) {
   List<int> c;
 
   c.swap(b);
-  EXPECT_EQ(b.front(), 0);
-  EXPECT_EQ(b.back(), 0);
-  EXPECT_EQ(*b.end(), 0);
-  EXPECT_EQ(*b.begin(), 0);
+  EXPECT_TRUE(b.begin() == b.end());
   EXPECT_EQ(c.size(), 4);
   auto it = c.begin();
   for (int i = 1; i < 5; ++i) {
@@ -314,10 +298,7 @@ TEST(List, splice) {
   b.splice(it, c);
   List<int> res = {1, 2, 1, 2, 3, 4, 5, 3, 4, 5};
   EXPECT_EQ(c.empty(), 1);
-  EXPECT_EQ(c.front(), 0);
-  EXPECT_EQ(c.back(), 0);
-  EXPECT_EQ(*c.end(), 0);
-  EXPECT_EQ(*c.begin(), 0);
+  EXPECT_TRUE(c.begin() == c.end());
   EXPECT_EQ(b == res, 1);
 
   b.splice(it, c);
@@ -326,10 +307,79 @@ TEST(List, splice) {
   c.splice(c.end(), b);
   EXPECT_EQ(c == res, 1);
   EXPECT_EQ(b.empty(), 1);
-  EXPECT_EQ(b.front(), 0);
-  EXPECT_EQ(b.back(), 0);
-  EXPECT_EQ(*b.end(), 0);
-  EXPECT_EQ(*b.begin(), 0);
+  EXPECT_TRUE(b.begin() == b.end());
+}
+
+TEST(List, ReverseRelinksNodes) {
+  List<std::string> a = {"one", "two", "three"};
+  auto it = a.begin();
+  const std::string* payload = &*it;
+  a.reverse();
+  EXPECT_EQ(&*it, payload);
+  EXPECT_EQ(*--a.end(), "one");
+  EXPECT_EQ(a.front(), "three");
+  ++it;
+  EXPECT_TRUE(it == a.end());
+  a.reverse();
+  List<std::string> res = {"one", "two", "three"};
+  EXPECT_EQ(a == res, 1);
+}
+
+TEST(List, SpliceElement) {
+  List<int> a = {1, 2, 3};
+  List<int> b = {10, 20};
+  auto it = b.begin();
+  ++it;
+  a.splice(a.begin(), b, it);
+  List<int> res_a = {20, 1, 2, 3};
+  List<int> res_b = {10};
+  EXPECT_EQ(a == res_a, 1);
+  EXPECT_EQ(b == res_b, 1);
+  EXPECT_EQ(a.size(), 4);
+  EXPECT_EQ(b.size(), 1);
+  EXPECT_EQ(*it, 20);
+
+  // moving an element within the list, including onto itself
+  a.splice(a.end(), a, a.begin());
+  a.splice(a.begin(), a, a.begin());
+  List<int> res_a2 = {1, 2, 3, 20};
+  EXPECT_EQ(a == res_a2, 1);
+  EXPECT_EQ(a.size(), 4);
+}
+
+TEST(List, SpliceRange) {
+  List<int> a = {1, 2, 3, 4, 5};
+  List<int> b = {10, 20, 30};
+  auto first = a.begin();
+  ++first;
+  auto last = first;
+  ++last;
+  ++last;
+  b.splice(++b.begin(), a, first, last);
+  List<int> res_a = {1, 4, 5};
+  List<int> res_b = {10, 2, 3, 20, 30};
+  EXPECT_EQ(a == res_a, 1);
+  EXPECT_EQ(b == res_b, 1);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(b.size(), 5);
+
+  b.splice(b.begin(), b, ++b.begin(), b.end());
+  List<int> res_b2 = {2, 3, 20, 30, 10};
+  EXPECT_EQ(b == res_b2, 1);
+  EXPECT_EQ(b.size(), 5);
+
+  a.splice(a.end(), b, b.begin(), b.begin());
+  EXPECT_EQ(a == res_a, 1);
+}
+
+TEST(List, MergeMovesNodes) {
+  List<std::string> a = {"a", "c"};
+  List<std::string> b = {"b", "d"};
+  const std::string* payload = &*b.begin();
+  a.merge(b);
+  EXPECT_EQ(b.empty(), 1);
+  EXPECT_EQ(a.size(), 4);
+  EXPECT_EQ(&*++a.begin(), payload);
 }
 
 TEST(List, Unique) {
@@ -353,10 +403,7 @@ TEST(List, Unique) {
   List<char> w = {};
   w.unique();
   EXPECT_EQ(w.empty(), 1);
-  EXPECT_EQ(w.front(), 0);
-  EXPECT_EQ(w.back(), 0);
-  EXPECT_EQ(*w.end(), 0);
-  EXPECT_EQ(*w.begin(), 0);
+  EXPECT_TRUE(w.begin() == w.end());
 }
 
 TEST(List, Sort) {
@@ -400,10 +447,7 @@ TEST(List, Operator) {
   }
   EXPECT_EQ(b.size(), 5);
   EXPECT_EQ(a.empty(), 1);
-  EXPECT_EQ(a.front(), 0);
-  EXPECT_EQ(a.back(), 0);
-  EXPECT_EQ(*a.end(), 0);
-  EXPECT_EQ(*a.begin(), 0);
+  EXPECT_TRUE(a.begin() == a.end());
 
   a = b;
   b = a;
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <string_view>
 
 TEST(MapTest, DefaultConstructor) {
   s21::map<int, std::string> myMap;
@@ -363,6 +364,7 @@ TEST(MapTest, ConstIter) {
   ASSERT_EQ(it->second, "two");
 
   it = map.cend();
+  --it;
 
   ASSERT_EQ(it->second, "three");
 }
@@ -412,4 +414,137 @@ TEST(BinaryTreeIteratorTest, DecrementWithLeftChild) {
 
   EXPECT_EQ(it->first, 6);
   EXPECT_EQ(it->second, 60);
-}
\ No newline at end of file
+}
+
+TEST(MapNodeHandleTest, ExtractAndInsert) {
+  s21::map<int, std::string> from = {{1, "one"}, {2, "two"}, {3, "three"}};
+  s21::map<int, std::string> to = {{4, "four"}};
+  const std::string* address = &from.find(2)->second;
+
+  auto node = from.extract(2);
+  ASSERT_FALSE(node.empty());
+  EXPECT_EQ(node.key(), 2);
+  node.mapped() = "deux";
+  EXPECT_EQ(from.size(), 2);
+  EXPECT_FALSE(from.contains(2));
+
+  auto result = to.insert(std::move(node));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_TRUE(result.node.empty());
+  EXPECT_EQ(&result.position->second, address);
+  EXPECT_EQ(to.at(2), "deux");
+  EXPECT_EQ(to.size(), 2);
+
+  node = from.extract(from.find(1));
+  EXPECT_EQ(node.key(), 1);
+  EXPECT_TRUE(from.extract(42).empty());
+  to.insert(1, "uno");
+  result = to.insert(std::move(node));
+  EXPECT_FALSE(result.inserted);
+  EXPECT_EQ(result.node.mapped(), "one");
+  EXPECT_EQ(result.position->second, "uno");
+}
+
+TEST(MapNodeHandleTest, MergeRelinksNodes) {
+  s21::map<int, int> map1;
+  s21::map<int, int> map2;
+  for (int k : {50, 20, 80, 10, 30}) map1.insert(k, k);
+  for (int k : {40, 20, 60, 30, 70, 90}) map2.insert(k, -k);
+  const int* sixty = &map2.find(60)->second;
+
+  map1.merge(map2);
+
+  EXPECT_EQ(map1.size(), 9);
+  EXPECT_EQ(&map1.find(60)->second, sixty);
+  EXPECT_EQ(map1.at(20), 20);
+  EXPECT_EQ(map1.at(90), -90);
+  ASSERT_EQ(map2.size(), 2);
+  EXPECT_EQ(map2.at(20), -20);
+  EXPECT_EQ(map2.at(30), -30);
+  int previous = 0;
+  for (auto it = map1.find(10); it != map1.find(90); ++it) {
+    EXPECT_LT(previous, it->first);
+    previous = it->first;
+  }
+}
+
+TEST(MapCompareTest, CustomOrder) {
+  s21::map<int, int, std::greater<int>> map1;
+  for (int k : {5, 1, 8, 3, 9}) map1.insert(k, k * 10);
+  EXPECT_EQ(map1.at(8), 80);
+  EXPECT_EQ(map1.lower_bound(7)->first, 5);
+  EXPECT_EQ(map1.lower_bound(9)->first, 9);
+  EXPECT_EQ(map1.erase(3), 1);
+  EXPECT_EQ(map1.erase(3), 0);
+  EXPECT_EQ(map1.count(3), 0);
+  EXPECT_EQ(map1.size(), 4);
+  auto it = map1.find(9);
+  ++it;
+  EXPECT_EQ(it->first, 8);
+}
+
+TEST(MapCompareTest, TransparentLookup) {
+  s21::map<std::string, int, std::less<>> map1 = {
+      {"one", 1}, {"two", 2}, {"three", 3}};
+  std::string_view two = "two";
+  EXPECT_TRUE(map1.contains(two));
+  EXPECT_EQ(map1.count(std::string_view("four")), 0);
+  EXPECT_EQ(map1.find(two)->second, 2);
+  EXPECT_EQ(map1.lower_bound(std::string_view("p"))->first, "three");
+  EXPECT_EQ(map1.erase(std::string_view("one")), 1);
+  EXPECT_FALSE(map1.contains(std::string_view("one")));
+  EXPECT_EQ(map1.size(), 2);
+}
+
+namespace {
+
+int comparisons = 0;
+
+struct CountingLess {
+  bool operator()(int a, int b) const {
+    ++comparisons;
+    return a < b;
+  }
+};
+
+}  // namespace
+
+TEST(MapCompareTest, OneComparisonPerLevel) {
+  s21::map<int, int, CountingLess> map1;
+  for (int k : {4, 2, 6, 1, 3, 5, 7}) map1.insert(k, k);
+  // three levels: a lookup costs at most three comparisons on the way
+  // down and one against the candidate
+  for (int k = 0; k <= 8; ++k) {
+    comparisons = 0;
+    EXPECT_EQ(map1.contains(k), k >= 1 && k <= 7);
+    EXPECT_LE(comparisons, 4);
+    comparisons = 0;
+    map1.insert_or_assign(k, -k);
+    EXPECT_LE(comparisons, 4);
+    map1.erase(0);
+    map1.erase(8);
+  }
+  EXPECT_EQ(map1.at(3), -3);
+  EXPECT_EQ(map1.size(), 7);
+}
+
+TEST(MapTest, LowerBoundPastTheLargestKey) {
+  s21::map<int, int> map1;
+  EXPECT_EQ(map1.lower_bound(1), map1.end());
+  for (int k : {4, 2, 6}) map1.insert(k, k * 10);
+  EXPECT_EQ(map1.lower_bound(5)->first, 6);
+  EXPECT_EQ(map1.lower_bound(6)->first, 6);
+  EXPECT_NE(map1.lower_bound(6), map1.lower_bound(7));
+  auto past = map1.lower_bound(7);
+  EXPECT_EQ(past, map1.end());
+  int visited = 0;
+  for (auto it = past; it != map1.end(); ++it) ++visited;
+  EXPECT_EQ(visited, 0);
+  --past;
+  EXPECT_EQ(past->first, 6);
+  EXPECT_EQ(map1.find(6), --map1.end());
+
+  int sum = 0;
+  for (const auto &entry : map1) sum += entry.second;
+  EXPECT_EQ(sum, 120);
+}
@@ -0,0 +1,95 @@
+#include "../s21_mapped_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+
+namespace {
+std::string TempFile(const char *name) { return testing::TempDir() + name; }
+}  // namespace
+
+TEST(MappedVectorTest, write_and_read) {
+  std::string path = TempFile("s21_mapped_1.bin");
+  s21::Vector<double> v;
+  for (int i = 0; i < 10000; ++i) v.push_back(i * 1.5);
+  s21::MappedVector<double>::Write(path, v);
+
+  s21::MappedVector<double> m(path);
+  ASSERT_TRUE(m.is_open());
+  ASSERT_EQ(m.size(), v.size());
+  EXPECT_EQ(m.front(), 0.0);
+  EXPECT_EQ(m.back(), 9999 * 1.5);
+  EXPECT_EQ(m[1234], v[1234]);
+  double sum = 0;
+  for (double x : m) sum += x;
+  EXPECT_EQ(sum, 1.5 * 9999 * 10000 / 2);
+  EXPECT_THROW(m.at(10000), std::out_of_range);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, empty_file) {
+  std::string path = TempFile("s21_mapped_2.bin");
+  s21::MappedVector<int>::Write(path, nullptr, 0);
+  s21::MappedVector<int> m(path);
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.begin(), m.end());
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, read_write_sync) {
+  std::string path = TempFile("s21_mapped_3.bin");
+  s21::Vector<int> v = {1, 2, 3, 4};
+  s21::MappedVector<int>::Write(path, v);
+  {
+    s21::MappedVector<int> m(path, s21::MappedVector<int>::Mode::kReadWrite);
+    m[2] = 30;
+    m.sync();
+  }
+  s21::MappedVector<int> m(path);
+  EXPECT_EQ(m[2], 30);
+  EXPECT_EQ(m[3], 4);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, read_only_writes_stay_private) {
+  std::string path = TempFile("s21_mapped_6.bin");
+  s21::Vector<int> v = {1, 2, 3};
+  s21::MappedVector<int>::Write(path, v);
+  {
+    s21::MappedVector<int> m(path);
+    m[1] = 20;
+    *m.begin() = 10;
+    EXPECT_EQ(m[1], 20);
+    EXPECT_EQ(m.front(), 10);
+  }
+  s21::MappedVector<int> m(path);
+  EXPECT_EQ(m[0], 1);
+  EXPECT_EQ(m[1], 2);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, type_mismatch) {
+  std::string path = TempFile("s21_mapped_4.bin");
+  s21::Vector<int> v = {1, 2, 3};
+  s21::MappedVector<int>::Write(path, v);
+  EXPECT_THROW(s21::MappedVector<double> m(path), std::runtime_error);
+  EXPECT_THROW(s21::MappedVector<int> m(path + ".missing"),
+               std::runtime_error);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, move) {
+  std::string path = TempFile("s21_mapped_5.bin");
+  s21::Vector<int> v = {7, 8, 9};
+  s21::MappedVector<int>::Write(path, v);
+  s21::MappedVector<int> m1(path);
+  s21::MappedVector<int> m2(std::move(m1));
+  EXPECT_FALSE(m1.is_open());
+  EXPECT_EQ(m1.size(), 0u);
+  EXPECT_EQ(m2[1], 8);
+  s21::MappedVector<int> m3;
+  m3 = std::move(m2);
+  EXPECT_EQ(m3.size(), 3u);
+  std::remove(path.c_str());
+}
@@ -0,0 +1,57 @@
+#include "../s21_mmap_storage.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+template <class T>
+using MmapVector = s21::Vector<T, s21::MmapStorage<T>>;
+
+TEST(MmapStorageTest, push_back_grows_in_place) {
+  MmapVector<double> v;
+  for (int i = 0; i < 1 << 20; ++i) v.push_back(i * 0.5);
+  EXPECT_EQ(v.size(), 1u << 20);
+  EXPECT_GE(v.capacity(), v.size());
+  for (int i = 0; i < 1 << 20; i += 4099) EXPECT_EQ(v[i], i * 0.5);
+}
+
+TEST(MmapStorageTest, reserve_keeps_values) {
+  MmapVector<int> v = {1, 2, 3};
+  v.reserve(10000000);
+  EXPECT_EQ(v.capacity(), 10000000u);
+  EXPECT_EQ(v.size(), 3u);
+  EXPECT_EQ(v[0], 1);
+  EXPECT_EQ(v[2], 3);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 3u);
+  EXPECT_EQ(v[1], 2);
+}
+
+TEST(MmapStorageTest, huge_page_alignment) {
+  MmapVector<char> v(s21::MmapStorage<char>::kHugePage);
+  uintptr_t addr = reinterpret_cast<uintptr_t>(v.data());
+  EXPECT_EQ(addr % s21::MmapStorage<char>::kHugePage, 0u);
+  EXPECT_EQ(v[0], 0);
+  EXPECT_EQ(v[v.size() - 1], 0);
+}
+
+TEST(MmapStorageTest, copy_and_move) {
+  MmapVector<int> v1(1000);
+  for (size_t i = 0; i < v1.size(); ++i) v1[i] = static_cast<int>(i);
+  MmapVector<int> v2(v1);
+  MmapVector<int> v3(std::move(v1));
+  EXPECT_EQ(v1.size(), 0u);
+  EXPECT_EQ(v2.size(), 1000u);
+  EXPECT_EQ(v3.size(), 1000u);
+  EXPECT_EQ(v2[999], 999);
+  EXPECT_EQ(v3[500], 500);
+}
+
+TEST(MmapStorageTest, non_trivial_type) {
+  MmapVector<std::string> v;
+  for (int i = 0; i < 100; ++i) v.push_back(std::to_string(i));
+  EXPECT_EQ(v.size(), 100u);
+  EXPECT_EQ(v[42], "42");
+  v.shrink_to_fit();
+  EXPECT_EQ(v.back(), "99");
+}
@@ -0,0 +1,104 @@
+#include "../s21_multimap.h"
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+
+TEST(MultimapTest, KeepsDuplicatesInInsertionOrder) {
+  s21::multimap<int, std::string> mm{{2, "b"}, {1, "a"}, {2, "c"}};
+  mm.insert(2, "d");
+  EXPECT_EQ(mm.size(), 4u);
+  EXPECT_EQ(mm.count(2), 3u);
+  auto range = mm.equal_range(2);
+  std::string joined;
+  for (auto it = range.first; it != range.second; ++it) {
+    joined += it->second;
+  }
+  EXPECT_EQ(joined, "bcd");
+  EXPECT_EQ(mm.begin()->first, 1);
+  EXPECT_EQ(mm.find(2)->second, "b");
+  EXPECT_EQ(mm.find(5), mm.end());
+}
+
+TEST(MultimapTest, MatchesStdMultimap) {
+  s21::multimap<int, int> mm;
+  std::multimap<int, int> ref;
+  std::mt19937 gen(43);
+  for (int i = 0; i < 3000; ++i) {
+    int key = gen() % 100;
+    if (gen() % 4 == 0) {
+      EXPECT_EQ(mm.erase(key), ref.erase(key));
+    } else {
+      mm.insert(key, i);
+      ref.insert({key, i});
+    }
+  }
+  ASSERT_EQ(mm.size(), ref.size());
+  auto it = ref.begin();
+  for (auto entry : mm) {
+    EXPECT_EQ(entry.first, it->first);
+    EXPECT_EQ(entry.second, it->second);
+    ++it;
+  }
+}
+
+TEST(MultimapTest, IteratorWritesThrough) {
+  s21::multimap<std::string, int> mm{{"x", 1}, {"x", 2}};
+  for (auto it = mm.begin(); it != mm.end(); ++it) it->second *= 10;
+  (*mm.begin()).second += 1;
+  auto it = mm.begin();
+  EXPECT_EQ(it->second, 11);
+  EXPECT_EQ((++it)->second, 20);
+  const auto &view = mm;
+  s21::multimap<std::string, int>::const_iterator first = view.begin();
+  EXPECT_EQ(first->first, "x");
+  int sum = 0;
+  for (const auto &entry : view) sum += entry.second;
+  EXPECT_EQ(sum, 31);
+}
+
+TEST(MultimapTest, ExtractMergeAndBounds) {
+  s21::multimap<int, char> a{{1, 'a'}, {3, 'c'}};
+  s21::multimap<int, char> b{{1, 'b'}, {2, 'x'}};
+  a.merge(b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.size(), 4u);
+  EXPECT_EQ(a.lower_bound(2)->second, 'x');
+  EXPECT_EQ(a.upper_bound(1)->first, 2);
+  auto node = a.extract(1);
+  EXPECT_EQ(node.key(), 1);
+  EXPECT_EQ(node.mapped(), 'a');
+  EXPECT_EQ(a.find(1)->second, 'b');
+  a.insert(std::move(node));
+  EXPECT_EQ(a.count(1), 2u);
+  EXPECT_EQ(std::prev(a.upper_bound(1))->second, 'a');
+  a.erase(a.begin());
+  EXPECT_EQ(a.begin()->second, 'a');
+}
+
+TEST(MultimapTest, TransparentLookup) {
+  s21::multimap<std::string, int, std::less<>> mm{{"k", 1}, {"k", 2}};
+  EXPECT_EQ(mm.count("k"), 2u);
+  EXPECT_TRUE(mm.contains("k"));
+  EXPECT_EQ(mm.find("k")->second, 1);
+  EXPECT_EQ(mm.erase("k"), 2u);
+  EXPECT_TRUE(mm.empty());
+}
+
+TEST(MultimapTest, IteratesBackwardsFromEnd) {
+  s21::multimap<int, char> mm{{2, 'b'}, {1, 'a'}, {2, 'c'}, {3, 'd'}};
+  std::string backwards;
+  for (auto it = mm.end(); it != mm.begin();) backwards += (--it)->second;
+  EXPECT_EQ(backwards, "dcba");
+  EXPECT_EQ(std::prev(mm.end())->first, 3);
+  EXPECT_EQ(std::prev(mm.upper_bound(2))->second, 'c');
+  const auto &view = mm;
+  s21::multimap<int, char>::const_iterator last = std::prev(view.end());
+  EXPECT_EQ(last->second, 'd');
+  s21::multimap<int, char> empty;
+  EXPECT_EQ(empty.begin(), empty.end());
+}
@@ -0,0 +1,162 @@
+#include "../s21_multiset.h"
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct ByFirst {
+  bool operator()(const std::pair<int, int> &a,
+                  const std::pair<int, int> &b) const {
+    return a.first < b.first;
+  }
+};
+
+template <typename Bag>
+auto Items(Bag &bag) {
+  std::vector<typename Bag::value_type> items;
+  for (auto it = bag.begin(); it != bag.end(); ++it) items.push_back(*it);
+  return items;
+}
+
+}  // namespace
+
+TEST(MultisetTest, KeepsDuplicates) {
+  s21::multiset<int> bag{5, 1, 5, 3, 5, 1};
+  std::multiset<int> ref{5, 1, 5, 3, 5, 1};
+  EXPECT_EQ(bag.size(), ref.size());
+  EXPECT_EQ(Items(bag), std::vector<int>(ref.begin(), ref.end()));
+  EXPECT_EQ(bag.count(5), 3u);
+  EXPECT_EQ(bag.count(1), 2u);
+  EXPECT_EQ(bag.count(4), 0u);
+  EXPECT_TRUE(bag.contains(3));
+  EXPECT_FALSE(bag.contains(2));
+}
+
+TEST(MultisetTest, EquivalentValuesStayInInsertionOrder) {
+  s21::multiset<std::pair<int, int>, ByFirst> bag;
+  for (int i = 0; i < 50; ++i) bag.insert({i % 5, i});
+  int last_first = -1, last_second = -1;
+  for (const auto &value : bag) {
+    if (value.first == last_first) {
+      EXPECT_GT(value.second, last_second);
+    }
+    EXPECT_GE(value.first, last_first);
+    last_first = value.first;
+    last_second = value.second;
+  }
+  auto first = bag.find({3, 0});
+  ASSERT_NE(first, bag.end());
+  EXPECT_EQ((*first).second, 3);
+}
+
+TEST(MultisetTest, EqualRangeAndBounds) {
+  s21::multiset<int> bag{1, 2, 2, 2, 4};
+  auto range = bag.equal_range(2);
+  int n = 0;
+  for (auto it = range.first; it != range.second; ++it, ++n) {
+    EXPECT_EQ(*it, 2);
+  }
+  EXPECT_EQ(n, 3);
+  EXPECT_EQ(*range.second, 4);
+  EXPECT_EQ(*bag.lower_bound(3), 4);
+  EXPECT_EQ(*bag.upper_bound(1), 2);
+  EXPECT_EQ(bag.upper_bound(4), bag.end());
+  range = bag.equal_range(3);
+  EXPECT_EQ(range.first, range.second);
+}
+
+TEST(MultisetTest, EraseKeyRemovesWholeRun) {
+  s21::multiset<int> bag;
+  std::multiset<int> ref;
+  for (int i = 0; i < 2000; ++i) {
+    bag.insert(i * 7 % 31);
+    ref.insert(i * 7 % 31);
+  }
+  for (int key : {0, 30, 15, 15, 99}) {
+    EXPECT_EQ(bag.erase(key), ref.erase(key));
+    EXPECT_EQ(bag.size(), ref.size());
+  }
+  EXPECT_EQ(Items(bag), std::vector<int>(ref.begin(), ref.end()));
+  bag.erase(bag.find(1));
+  EXPECT_EQ(bag.count(1), ref.count(1) - 1);
+}
+
+TEST(MultisetTest, ExtractAndInsertNode) {
+  s21::multiset<std::string> bag{"b", "a", "b"};
+  auto node = bag.extract(std::string("b"));
+  ASSERT_FALSE(node.empty());
+  EXPECT_EQ(node.value(), "b");
+  EXPECT_EQ(bag.size(), 2u);
+  auto it = bag.insert(std::move(node));
+  EXPECT_EQ(*it, "b");
+  EXPECT_EQ(bag.count("b"), 2u);
+  EXPECT_TRUE(bag.extract(bag.end()).empty());
+}
+
+TEST(MultisetTest, MergeMovesEverything) {
+  s21::multiset<std::pair<int, int>, ByFirst> a, b;
+  a.insert({1, 0});
+  a.insert({2, 0});
+  b.insert({1, 1});
+  b.insert({3, 1});
+  b.insert({1, 2});
+  a.merge(b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.size(), 5u);
+  std::vector<std::pair<int, int>> expected{
+      {1, 0}, {1, 1}, {1, 2}, {2, 0}, {3, 1}};
+  EXPECT_EQ(Items(a), expected);
+}
+
+TEST(MultisetTest, TransparentLookup) {
+  s21::multiset<std::string, std::less<>> bag{"pear", "fig", "pear"};
+  EXPECT_EQ(bag.count("pear"), 2u);
+  EXPECT_TRUE(bag.contains("fig"));
+  EXPECT_EQ(*bag.find("fig"), "fig");
+  EXPECT_EQ(bag.erase("pear"), 2u);
+  EXPECT_EQ(bag.size(), 1u);
+}
+
+TEST(MultisetTest, SwapAndClear) {
+  s21::multiset<int> a{1, 1, 2}, b{3};
+  a.swap(b);
+  EXPECT_EQ(a.size(), 1u);
+  EXPECT_EQ(b.count(1), 2u);
+  b.clear();
+  EXPECT_TRUE(b.empty());
+  b.insert_many(4, 4, 5);
+  EXPECT_EQ(b.count(4), 2u);
+}
+
+TEST(MultisetTest, IteratesThroughConstReference) {
+  s21::multiset<int> bag{4, 2, 4, 1};
+  const s21::multiset<int> &view = bag;
+  EXPECT_EQ(Items(view), (std::vector<int>{1, 2, 4, 4}));
+  int sum = 0;
+  for (int value : view) sum += value;
+  EXPECT_EQ(sum, 11);
+  s21::multiset<int>::const_iterator it = view.begin();
+  ++it;
+  ++it;
+  EXPECT_EQ(*it, 4);
+  --it;
+  EXPECT_EQ(*it, 2);
+}
+
+TEST(MultisetTest, IteratesBackwardsFromEnd) {
+  s21::multiset<int> bag{3, 1, 3, 2};
+  std::vector<int> backwards;
+  for (auto it = bag.end(); it != bag.begin();) backwards.push_back(*--it);
+  EXPECT_EQ(backwards, (std::vector<int>{3, 3, 2, 1}));
+  EXPECT_EQ(*std::prev(bag.end()), 3);
+  EXPECT_EQ(*std::prev(bag.upper_bound(2)), 2);
+  const s21::multiset<int> &view = bag;
+  EXPECT_EQ(*std::prev(view.end()), 3);
+  EXPECT_EQ(std::distance(view.begin(), view.end()), 4);
+}
@@ -0,0 +1,112 @@
+#include "../s21_parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../s21_array.h"
+
+namespace {
+s21::Vector<int> Shuffled(int n) {
+  s21::Vector<int> v(n);
+  for (int i = 0; i < n; ++i) v[i] = static_cast<int>((i * 7919LL) % n);
+  return v;
+}
+}  // namespace
+
+TEST(ParallelTest, thread_count) {
+  s21::parallel::set_thread_count(3);
+  EXPECT_EQ(s21::parallel::thread_count(), 3u);
+  s21::parallel::set_thread_count(4);
+  EXPECT_EQ(s21::parallel::thread_count(), 4u);
+}
+
+TEST(ParallelTest, sort) {
+  for (size_t threads : {1, 4}) {
+    s21::parallel::set_thread_count(threads);
+    for (int n : {0, 1, 1000, 300007}) {
+      s21::Vector<int> v = Shuffled(n);
+      s21::parallel::sort(v.begin(), v.end());
+      for (int i = 0; i < n; ++i) ASSERT_EQ(v[i], i);
+    }
+  }
+  s21::Vector<int> v = Shuffled(100000);
+  s21::parallel::sort(v.begin(), v.end(), std::greater<>());
+  EXPECT_TRUE(std::is_sorted(v.begin(), v.end(), std::greater<>()));
+}
+
+TEST(ParallelTest, for_each_and_transform) {
+  s21::parallel::set_thread_count(4);
+  s21::Vector<double> v(200000);
+  s21::parallel::for_each(v.begin(), v.end(), [](double &x) { x = 2; });
+  s21::Vector<double> out(v.size());
+  auto end = s21::parallel::transform(v.begin(), v.end(), out.begin(),
+                                      [](double x) { return x * 1.5; });
+  EXPECT_EQ(end, out.end());
+  EXPECT_TRUE(std::all_of(out.begin(), out.end(),
+                          [](double x) { return x == 3.0; }));
+}
+
+TEST(ParallelTest, reduce) {
+  s21::parallel::set_thread_count(4);
+  s21::Vector<long long> v(500000);
+  std::iota(v.begin(), v.end(), 1);
+  EXPECT_EQ(s21::parallel::reduce(v.begin(), v.end(), 0LL),
+            500000LL * 500001 / 2);
+  EXPECT_EQ(s21::parallel::reduce(v.begin(), v.begin(), 7LL), 7);
+  long long max = s21::parallel::reduce(
+      v.begin(), v.end(), 0LL,
+      [](long long a, long long b) { return std::max(a, b); });
+  EXPECT_EQ(max, 500000);
+}
+
+TEST(ParallelTest, inclusive_scan) {
+  s21::parallel::set_thread_count(4);
+  s21::Vector<int> v(100000);
+  std::fill(v.begin(), v.end(), 1);
+  s21::Vector<int> out(v.size());
+  s21::parallel::inclusive_scan(v.begin(), v.end(), out.begin());
+  for (int i = 0; i < 100000; ++i) ASSERT_EQ(out[i], i + 1);
+  s21::parallel::inclusive_scan(v.begin(), v.end(), v.begin());
+  EXPECT_EQ(v[99999], 100000);
+}
+
+TEST(ParallelTest, array) {
+  s21::Array<int, 5> a = {5, 1, 4, 2, 3};
+  s21::parallel::sort(a.begin(), a.end());
+  EXPECT_EQ(a[0], 1);
+  EXPECT_EQ(a[4], 5);
+  EXPECT_EQ(s21::parallel::reduce(a.begin(), a.end(), 0), 15);
+}
+
+TEST(ParallelTest, exception) {
+  s21::parallel::set_thread_count(4);
+  s21::Vector<int> v(100000);
+  EXPECT_THROW(s21::parallel::for_each(v.begin(), v.end(),
+                                       [](int &) {
+                                         throw std::runtime_error("boom");
+                                       }),
+               std::runtime_error);
+}
+
+TEST(ParallelTest, concurrent_callers_share_the_pool) {
+  s21::parallel::set_thread_count(4);
+  std::vector<s21::Vector<int>> results(4, s21::Vector<int>(100000));
+  std::vector<std::thread> callers;
+  for (size_t t = 0; t < results.size(); ++t) {
+    callers.emplace_back([&results, t] {
+      s21::Vector<int> &v = results[t];
+      s21::parallel::for_each(v.begin(), v.end(),
+                              [t](int &x) { x = static_cast<int>(t); });
+    });
+  }
+  for (auto &caller : callers) caller.join();
+  for (size_t t = 0; t < results.size(); ++t) {
+    EXPECT_EQ(std::count(results[t].begin(), results[t].end(), int(t)),
+              100000);
+  }
+}
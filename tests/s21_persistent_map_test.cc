@@ -0,0 +1,118 @@
+#include "../s21_persistent_map.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+template <typename Map>
+std::vector<std::pair<int, int>> Items(const Map &m) {
+  std::vector<std::pair<int, int>> items;
+  for (const auto &entry : m) items.emplace_back(entry.first, entry.second);
+  return items;
+}
+
+}  // namespace
+
+TEST(PersistentMapTest, updates_leave_old_versions_intact) {
+  s21::persistent_map<std::string, int> v0{{"a", 1}, {"b", 2}, {"a", 9}};
+  EXPECT_EQ(v0.size(), 2u);
+  EXPECT_EQ(v0.at("a"), 1);
+  auto v1 = v0.insert("c", 3);
+  auto v2 = v1.insert_or_assign("a", 10);
+  auto v3 = v2.erase("b");
+  EXPECT_EQ(v0.size(), 2u);
+  EXPECT_FALSE(v0.contains("c"));
+  EXPECT_EQ(v1.size(), 3u);
+  EXPECT_EQ(v1.at("a"), 1);
+  EXPECT_EQ(v2.at("a"), 10);
+  EXPECT_EQ(v2.count("b"), 1u);
+  EXPECT_EQ(v3.size(), 2u);
+  EXPECT_FALSE(v3.contains("b"));
+  EXPECT_THROW(v3.at("b"), std::out_of_range);
+
+  // no-op updates hand back the same version
+  auto same = v3.insert("a", 0).erase("zzz");
+  EXPECT_EQ(same.at("a"), 10);
+  EXPECT_EQ(same.size(), v3.size());
+  EXPECT_EQ(&*same.find("a"), &*v3.find("a"));
+}
+
+TEST(PersistentMapTest, iteration_and_find) {
+  s21::persistent_map<int, int> m;
+  for (int i : {5, 3, 8, 1, 4, 7, 9, 2, 6}) m = m.insert(i, i * i);
+  int expected = 1;
+  for (const auto &entry : m) {
+    EXPECT_EQ(entry.first, expected);
+    EXPECT_EQ(entry.second, expected * expected);
+    ++expected;
+  }
+  EXPECT_EQ(expected, 10);
+  auto it = m.find(4);
+  ASSERT_NE(it, m.end());
+  int rest = 0;
+  for (; it != m.end(); ++it) rest += it->first;
+  EXPECT_EQ(rest, 4 + 5 + 6 + 7 + 8 + 9);
+  EXPECT_EQ(m.find(10), m.end());
+  s21::persistent_map<int, int> none;
+  EXPECT_EQ(none.begin(), none.end());
+}
+
+TEST(PersistentMapTest, matches_std_map_across_versions) {
+  std::mt19937 gen(45);
+  std::vector<s21::persistent_map<int, int>> versions(1);
+  std::vector<std::map<int, int>> expected(1);
+  for (int step = 0; step < 3000; ++step) {
+    size_t from = gen() % versions.size();
+    int key = gen() % 300;
+    auto m = versions[from];
+    auto ref = expected[from];
+    switch (gen() % 3) {
+      case 0:
+        m = m.insert(key, step);
+        ref.insert({key, step});
+        break;
+      case 1:
+        m = m.insert_or_assign(key, step);
+        ref[key] = step;
+        break;
+      default:
+        m = m.erase(key);
+        ref.erase(key);
+    }
+    versions.push_back(m);
+    expected.push_back(ref);
+  }
+  for (size_t i = 0; i < versions.size(); i += 97) {
+    ASSERT_EQ(versions[i].size(), expected[i].size());
+    EXPECT_EQ(Items(versions[i]), Items(expected[i]));
+  }
+  EXPECT_EQ(Items(versions.back()), Items(expected.back()));
+}
+
+TEST(PersistentMapTest, readers_keep_snapshots_while_writer_updates) {
+  s21::persistent_map<int, int> current;
+  for (int i = 0; i < 1000; ++i) current = current.insert(i, 0);
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 2; ++r) {
+    readers.emplace_back([snapshot = current] {
+      for (int round = 0; round < 20; ++round) {
+        long sum = 0;
+        for (const auto &entry : snapshot) sum += entry.second;
+        EXPECT_EQ(sum, 0);
+        EXPECT_EQ(snapshot.size(), 1000u);
+      }
+    });
+  }
+  for (int i = 0; i < 1000; ++i) {
+    current = current.insert_or_assign(i, i).erase(i + 1000);
+  }
+  for (auto &reader : readers) reader.join();
+  EXPECT_EQ(current.at(999), 999);
+}
@@ -0,0 +1,99 @@
+#include "../s21_priority_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <queue>
+#include <string>
+
+#include "../s21_deque.h"
+
+TEST(PriorityQueueTest, matches_std_priority_queue) {
+  s21::PriorityQueue<int> pq;
+  std::priority_queue<int> expected;
+  unsigned seed = 11;
+  for (int step = 0; step < 20000; ++step) {
+    seed = seed * 1103515245 + 12345;
+    if ((seed >> 16) % 3 != 0 || expected.empty()) {
+      int value = static_cast<int>(seed >> 8) % 1000;
+      pq.push(value);
+      expected.push(value);
+    } else {
+      ASSERT_EQ(pq.top(), expected.top());
+      pq.pop();
+      expected.pop();
+    }
+    ASSERT_EQ(pq.size(), expected.size());
+  }
+  while (!expected.empty()) {
+    ASSERT_EQ(pq.top(), expected.top());
+    pq.pop();
+    expected.pop();
+  }
+  EXPECT_TRUE(pq.empty());
+}
+
+TEST(PriorityQueueTest, heapify_compare_and_container) {
+  s21::PriorityQueue<int, s21::Deque<int>, std::greater<int>> pq = {
+      5, 3, 9, 1, 7, 2, 8, 6, 4, 0};
+  pq.insert_many_back(-1, 10);
+  for (int i = -1; i <= 10; ++i) {
+    ASSERT_EQ(pq.top(), i);
+    pq.pop();
+  }
+  pq.pop();
+  EXPECT_TRUE(pq.empty());
+
+  s21::PriorityQueue<std::string> a = {"b", "a"};
+  s21::PriorityQueue<std::string> b = {"z"};
+  a.swap(b);
+  EXPECT_EQ(a.top(), "z");
+  EXPECT_EQ(b.top(), "b");
+}
+
+TEST(IndexedPriorityQueueTest, decrease_key_and_erase) {
+  // min-queue of distances, Dijkstra style
+  s21::IndexedPriorityQueue<int, std::greater<int>> pq;
+  s21::Vector<decltype(pq)::handle> handles;
+  for (int i = 0; i < 100; ++i) handles.push_back(pq.push(1000 + i));
+  pq.decrease_key(handles[50], 5);
+  pq.decrease_key(handles[70], 3);
+  EXPECT_THROW(pq.decrease_key(handles[70], 4), std::invalid_argument);
+  EXPECT_EQ(pq.top(), 3);
+  EXPECT_EQ(pq.top_handle(), handles[70]);
+
+  pq.erase(handles[70]);
+  EXPECT_FALSE(pq.contains(handles[70]));
+  EXPECT_THROW(pq.erase(handles[70]), std::out_of_range);
+  EXPECT_EQ(pq.top(), 5);
+  pq.update(handles[50], 2000);
+  EXPECT_EQ(pq.top(), 1000);
+  EXPECT_EQ(pq[handles[99]], 1099);
+  for (int i = 0; i < 10; ++i) pq.erase(handles[i * 3]);
+  EXPECT_EQ(pq.size(), 89u);
+
+  int previous = -1;
+  while (!pq.empty()) {
+    EXPECT_GE(pq.top(), previous);
+    previous = pq.top();
+    pq.pop();
+  }
+  EXPECT_EQ(previous, 2000);
+  auto reused = pq.push(1);
+  EXPECT_EQ(pq[reused], 1);
+  EXPECT_TRUE(pq.contains(reused));
+}
+
+TEST(IndexedPriorityQueueTest, stale_handles_miss_recycled_slots) {
+  s21::IndexedPriorityQueue<int> pq;
+  auto first = pq.push(10);
+  pq.pop();
+  auto second = pq.push(20);  // takes the slot first had
+  EXPECT_NE(first, second);
+  EXPECT_FALSE(pq.contains(first));
+  EXPECT_THROW(pq.erase(first), std::out_of_range);
+  EXPECT_THROW(pq.update(first, 30), std::out_of_range);
+  EXPECT_THROW(pq.decrease_key(first, 30), std::out_of_range);
+  EXPECT_EQ(pq.size(), 1u);
+  EXPECT_EQ(pq[second], 20);
+  EXPECT_EQ(pq.top_handle(), second);
+}
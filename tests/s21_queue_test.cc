@@ -6,6 +6,8 @@
 #include <iostream>
 #include <queue>
 
+#include "../s21_deque.h"
+
 namespace s21 {
 
 TEST(Queue, Construtor) {
@@ -152,4 +154,21 @@ TEST(Queue, InsertManyBack) {
   }
 }
 
+TEST(Queue, DequeContainer) {
+  Queue<int, Deque<int>> a = {1, 2, 3};
+  Queue<int, Deque<int>> b(4);
+  EXPECT_EQ(b.size(), 4u);
+  EXPECT_EQ(b.front(), 0);
+  for (int i = 4; i <= 1000; ++i) a.push(i);
+  a.insert_many_back(1001, 1002);
+  EXPECT_EQ(a.back(), 1002);
+  a.swap(b);
+  EXPECT_EQ(a.size(), 4u);
+  for (int i = 1; i <= 1002; ++i) {
+    ASSERT_EQ(b.front(), i);
+    b.pop();
+  }
+  EXPECT_TRUE(b.empty());
+}
+
 }  // namespace s21
@@ -2,6 +2,32 @@
 
 #include <gtest/gtest.h>
 
+#include <functional>
+#include <set>
+#include <string>
+#include <string_view>
+
+namespace {
+RedBlackTree<int, int> Random(int n, int range, unsigned seed,
+                              std::set<int> &keys) {
+  RedBlackTree<int, int> rbt;
+  for (int i = 0; i < n; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % range);
+    rbt.AddNode(key, key);
+    keys.insert(key);
+  }
+  return rbt;
+}
+
+void ExpectKeys(RedBlackTree<int, int> &rbt, const std::set<int> &keys) {
+  EXPECT_NE(rbt.CountBlack(), -1);
+  ASSERT_EQ(rbt.GetSize(), keys.size());
+  auto key = keys.begin();
+  for (auto it = rbt.begin(); it != rbt.end(); ++it) EXPECT_EQ(*it, *key++);
+}
+}  // namespace
+
 TEST(RedBlackTest, test1) {
   RedBlackTree<int, int> rbt;
   rbt.AddNode(3, 3);
@@ -58,6 +84,145 @@ TEST(RedBlackTest, test5) {
   EXPECT_EQ(rbt.CountBlack(), rbt1.CountBlack());
 }
 
+TEST(RedBlackTest, build_sorted) {
+  for (int n : {0, 1, 2, 3, 7, 8, 100, 1023}) {
+    RedBlackTree<int, int> rbt(5, 5);
+    int next = 0;
+    rbt.BuildSorted(n, [&next] {
+      ++next;
+      return std::make_pair(next, -next);
+    });
+    EXPECT_EQ(rbt.GetSize(), size_t(n));
+    EXPECT_NE(rbt.CountBlack(), -1);
+    int expected = 1;
+    for (auto it = rbt.begin(); it != rbt.end(); ++it) {
+      EXPECT_EQ(*it, -expected++);
+    }
+    EXPECT_EQ(expected, n + 1);
+  }
+}
+
+TEST(RedBlackTest, random_insert_delete_keeps_invariants) {
+  std::set<int> keys;
+  RedBlackTree<int, int> rbt = Random(5000, 100000, 1, keys);
+  ExpectKeys(rbt, keys);
+  unsigned seed = 99;
+  for (int i = 0; i < 4000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 100000);
+    rbt.DeleteNode(key);
+    keys.erase(key);
+    if (!keys.empty() && i % 2) {
+      rbt.DeleteNode(*keys.begin());
+      keys.erase(keys.begin());
+    }
+  }
+  ExpectKeys(rbt, keys);
+  RedBlackTree<int, int> empty;
+  RedBlackTree<int, int> copy(empty);
+  EXPECT_EQ(copy.GetSize(), 0u);
+}
+
+TEST(RedBlackTest, set_algebra) {
+  for (int sizes : {0, 1, 2, 3}) {
+    int n = sizes & 1 ? 3000 : 40;
+    int m = sizes & 2 ? 2500 : 7;
+    std::set<int> a_keys, b_keys, expected;
+    RedBlackTree<int, int> a = Random(n, 5000, 7 + sizes, a_keys);
+    RedBlackTree<int, int> b = Random(m, 5000, 1000 + sizes, b_keys);
+
+    RedBlackTree<int, int> u(a);
+    u.Unite(b);
+    expected = a_keys;
+    expected.insert(b_keys.begin(), b_keys.end());
+    ExpectKeys(u, expected);
+
+    RedBlackTree<int, int> in(a);
+    in.Intersect(b);
+    expected.clear();
+    for (int k : a_keys) {
+      if (b_keys.count(k)) expected.insert(k);
+    }
+    ExpectKeys(in, expected);
+
+    RedBlackTree<int, int> d(a);
+    d.Subtract(b);
+    expected.clear();
+    for (int k : a_keys) {
+      if (!b_keys.count(k)) expected.insert(k);
+    }
+    ExpectKeys(d, expected);
+
+    RedBlackTree<int, int> merged(b);
+    merged.Merge(a);
+    expected = a_keys;
+    expected.insert(b_keys.begin(), b_keys.end());
+    ExpectKeys(merged, expected);
+    expected.clear();
+    for (int k : a_keys) {
+      if (b_keys.count(k)) expected.insert(k);
+    }
+    ExpectKeys(a, expected);
+  }
+}
+
+namespace {
+
+int comparisons = 0;
+
+struct CountingLess {
+  bool operator()(int a, int b) const {
+    ++comparisons;
+    return a < b;
+  }
+};
+
+}  // namespace
+
+TEST(RedBlackTest, one_comparison_per_level) {
+  RedBlackTree<int, int, CountingLess> rbt;
+  for (int i = 0; i < 2000; ++i) rbt.AddNode(i * 37 % 2000, i);
+  int bound = rbt.Height() + 2;
+  for (int key = -1; key <= 2000; ++key) {
+    comparisons = 0;
+    bool found = rbt.FindNode(key) != NULL;
+    EXPECT_EQ(found, key >= 0 && key < 2000);
+    EXPECT_LE(comparisons, bound);
+    comparisons = 0;
+    EXPECT_EQ(rbt.AddNode(key, 0).second, !found);
+    EXPECT_LE(comparisons, bound + 1);
+  }
+}
+
+namespace {
+
+// Has a compare() member that is not a three-way comparison.
+struct Version {
+  int major;
+  bool compare(const Version &other) const { return major != other.major; }
+  bool operator<(const Version &other) const { return major < other.major; }
+};
+
+}  // namespace
+
+TEST(RedBlackTest, three_way_only_for_strings) {
+  using s21::detail::kThreeWay;
+  EXPECT_TRUE((kThreeWay<std::less<std::string>, std::string, std::string>));
+  EXPECT_TRUE((kThreeWay<std::less<>, std::string_view, std::string>));
+  EXPECT_FALSE((kThreeWay<std::less<Version>, Version, Version>));
+  EXPECT_FALSE((kThreeWay<std::less<>, std::wstring, std::string>));
+  EXPECT_FALSE(
+      (kThreeWay<std::greater<std::string>, std::string, std::string>));
+
+  RedBlackTree<Version, int> rbt;
+  for (int major : {3, 1, 4, 1, 5, 9, 2, 6}) rbt.AddNode(Version{major}, 0);
+  EXPECT_EQ(rbt.GetSize(), 7u);
+  for (int major = 0; major <= 10; ++major) {
+    bool present = major != 0 && major != 7 && major != 8 && major != 10;
+    EXPECT_EQ(rbt.FindNode(Version{major}) != NULL, present);
+  }
+}
+
 // int main(int argc, char **argv) {
 //   ::testing::InitGoogleTest(&argc, argv);
 
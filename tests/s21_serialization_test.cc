@@ -0,0 +1,190 @@
+#include "../s21_serialization.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#include "../s21_list.h"
+#include "../s21_map.h"
+#include "../s21_set.h"
+#include "../s21_vector.h"
+
+TEST(SerializationTest, vector_stream) {
+  s21::Vector<double> v;
+  for (int i = 0; i < 1000; ++i) v.push_back(i / 4.0);
+  std::stringstream ss;
+  v.serialize(ss);
+  EXPECT_EQ(ss.str().size(), v.serialized_size());
+  EXPECT_EQ(v.serialized_size(), 1 + 8 + 1000 * sizeof(double));
+
+  s21::Vector<double> copy = {1.0, 2.0};
+  copy.deserialize(ss);
+  ASSERT_EQ(copy.size(), 1000u);
+  for (size_t i = 0; i < copy.size(); ++i) EXPECT_EQ(copy[i], v[i]);
+}
+
+TEST(SerializationTest, vector_of_strings_buffer) {
+  s21::Vector<std::string> v = {"alpha", "", "gamma"};
+  std::string buffer(v.serialized_size(), '\0');
+  EXPECT_EQ(v.serialize(buffer.data(), buffer.size()), buffer.size());
+
+  s21::Vector<std::string> copy;
+  EXPECT_EQ(copy.deserialize(buffer.data(), buffer.size()), buffer.size());
+  ASSERT_EQ(copy.size(), 3u);
+  EXPECT_EQ(copy[0], "alpha");
+  EXPECT_EQ(copy[1], "");
+  EXPECT_EQ(copy[2], "gamma");
+}
+
+TEST(SerializationTest, buffer_errors) {
+  s21::Vector<int> v = {1, 2, 3};
+  char small[8];
+  EXPECT_THROW(v.serialize(small, sizeof(small)), std::length_error);
+  std::string buffer(v.serialized_size(), '\0');
+  v.serialize(buffer.data(), buffer.size());
+  s21::Vector<int> copy;
+  EXPECT_THROW(copy.deserialize(buffer.data(), buffer.size() - 1),
+               std::runtime_error);
+  buffer[0] = 7;
+  EXPECT_THROW(copy.deserialize(buffer.data(), buffer.size()),
+               std::runtime_error);
+}
+
+namespace {
+
+// A stream over fixed bytes that can't seek, like a pipe.
+class PipeBuf : public std::streambuf {
+ public:
+  explicit PipeBuf(std::string &bytes) {
+    setg(bytes.data(), bytes.data(), bytes.data() + bytes.size());
+  }
+};
+
+}  // namespace
+
+TEST(SerializationTest, count_larger_than_data) {
+  s21::Vector<int> v = {1, 2, 3};
+  std::string buffer(v.serialized_size(), '\0');
+  v.serialize(buffer.data(), buffer.size());
+  uint64_t huge = uint64_t(1) << 60;
+  std::memcpy(&buffer[1], &huge, sizeof(huge));
+  s21::Vector<int> copy;
+  EXPECT_THROW(copy.deserialize(buffer.data(), buffer.size()),
+               std::runtime_error);
+  std::stringstream ss(buffer);
+  EXPECT_THROW(copy.deserialize(ss), std::runtime_error);
+  s21::List<int> l;
+  std::stringstream ls(buffer);
+  EXPECT_THROW(l.deserialize(ls), std::runtime_error);
+  set<int> s;
+  std::stringstream sets(buffer);
+  EXPECT_THROW(s.deserialize(sets), std::runtime_error);
+
+  // unseekable: the count can't be checked up front, so reading runs out
+  PipeBuf pipe(buffer);
+  std::istream is(&pipe);
+  EXPECT_THROW(copy.deserialize(is), std::runtime_error);
+
+  // a pipe carrying an honest dump still loads
+  huge = 3;
+  std::memcpy(&buffer[1], &huge, sizeof(huge));
+  PipeBuf honest(buffer);
+  std::istream his(&honest);
+  copy.deserialize(his);
+  EXPECT_EQ(copy.size(), 3u);
+  EXPECT_EQ(copy[2], 3);
+}
+
+TEST(SerializationTest, string_longer_than_data) {
+  s21::Vector<std::string> v = {"abc"};
+  std::string buffer(v.serialized_size(), '\0');
+  v.serialize(buffer.data(), buffer.size());
+  // the length of the one string follows the 9-byte header
+  uint64_t huge = uint64_t(1) << 60;
+  std::memcpy(&buffer[9], &huge, sizeof(huge));
+  s21::Vector<std::string> copy;
+  EXPECT_THROW(copy.deserialize(buffer.data(), buffer.size()),
+               std::runtime_error);
+  std::stringstream ss(buffer);
+  EXPECT_THROW(copy.deserialize(ss), std::runtime_error);
+  PipeBuf pipe(buffer);
+  std::istream is(&pipe);
+  EXPECT_THROW(copy.deserialize(is), std::runtime_error);
+
+  // lengths past one chunk still load from a stream
+  v[0] = std::string(3 * s21::serialization::kReadChunk + 5, 'x');
+  std::stringstream big;
+  v.serialize(big);
+  copy.deserialize(big);
+  EXPECT_EQ(copy[0], v[0]);
+}
+
+TEST(SerializationTest, foreign_byte_order) {
+  s21::Vector<uint32_t> v = {0x01020304u};
+  std::string buffer(v.serialized_size(), '\0');
+  v.serialize(buffer.data(), buffer.size());
+  // rewrite the dump as if it came from a host of the other byte order
+  buffer[0] = buffer[0] == s21::serialization::kLittleEndian
+                  ? s21::serialization::kBigEndian
+                  : s21::serialization::kLittleEndian;
+  std::reverse(buffer.begin() + 1, buffer.begin() + 9);
+  std::reverse(buffer.begin() + 9, buffer.end());
+  s21::Vector<uint32_t> copy;
+  copy.deserialize(buffer.data(), buffer.size());
+  ASSERT_EQ(copy.size(), 1u);
+  EXPECT_EQ(copy[0], 0x01020304u);
+}
+
+TEST(SerializationTest, list) {
+  s21::List<int> l = {5, 4, 3, 2, 1};
+  std::stringstream ss;
+  l.serialize(ss);
+  s21::List<int> copy = {9};
+  copy.deserialize(ss);
+  EXPECT_TRUE(copy == l);
+}
+
+TEST(SerializationTest, set_rebuilds_balanced_tree) {
+  set<int> s;
+  for (int i = 0; i < 1000; ++i) s.insert(i * 7 % 1000);
+  std::stringstream ss;
+  s.serialize(ss);
+
+  set<int> copy{-5, 2000};
+  copy.deserialize(ss);
+  EXPECT_EQ(copy.size(), 1000u);
+  int expected = 0;
+  for (auto it = copy.begin(); it != copy.end(); ++it) {
+    EXPECT_EQ(*it, expected++);
+  }
+  EXPECT_FALSE(copy.contains(-5));
+  EXPECT_TRUE(copy.contains(999));
+  copy.insert(1000);
+  copy.erase(copy.find(500));
+  EXPECT_EQ(copy.size(), 1000u);
+}
+
+TEST(SerializationTest, set_rejects_unsorted) {
+  s21::Vector<int> unsorted = {1, 3, 2};
+  std::stringstream ss;
+  unsorted.serialize(ss);
+  set<int> s;
+  EXPECT_THROW(s.deserialize(ss), std::invalid_argument);
+}
+
+TEST(SerializationTest, map) {
+  s21::map<int, std::string> m = {{3, "three"}, {1, "one"}, {2, "two"}};
+  std::string buffer(m.serialized_size(), '\0');
+  m.serialize(buffer.data(), buffer.size());
+
+  s21::map<int, std::string> copy = {{10, "ten"}};
+  copy.deserialize(buffer.data(), buffer.size());
+  EXPECT_EQ(copy.size(), 3u);
+  EXPECT_EQ(copy.at(1), "one");
+  EXPECT_EQ(copy.at(2), "two");
+  EXPECT_EQ(copy.at(3), "three");
+  EXPECT_FALSE(copy.contains(10));
+}
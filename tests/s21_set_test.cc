@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <string_view>
+
 TEST(setCtor, test1) {
   set<int> set;
   set.insert(3);
@@ -203,6 +206,130 @@ TEST(swapTest, test13) {
   EXPECT_EQ(set2.contains(22), set4.contains(22));
 }
 
+TEST(setAlgebra, test14) {
+  set<int> a{1, 2, 3, 4, 5};
+  set<int> b{4, 5, 6};
+  set<int> u(a);
+  u.unite(b);
+  EXPECT_EQ(u.size(), 6u);
+  set<int> i(a);
+  i.intersect(b);
+  EXPECT_EQ(i.size(), 2u);
+  EXPECT_TRUE(i.contains(4) && i.contains(5));
+  set<int> d(a);
+  d.subtract(b);
+  EXPECT_EQ(d.size(), 3u);
+  EXPECT_FALSE(d.contains(4));
+  EXPECT_EQ(b.size(), 3u);
+  d.subtract(d);
+  EXPECT_TRUE(d.empty());
+}
+
+TEST(setAlgebra, parallel) {
+  s21::parallel::set_thread_count(4);
+  set<int> evens, thirds;
+  for (int k = 0; k < 200000; k += 2) evens.insert(k);
+  for (int k = 0; k < 200000; k += 3) thirds.insert(k);
+  set<int> u(evens), i(evens), d(evens), m(evens), other(thirds);
+  u.unite(s21::parallel::par, thirds);
+  i.intersect(s21::parallel::par, thirds);
+  d.subtract(s21::parallel::par, thirds);
+  m.merge(s21::parallel::par, other);
+  EXPECT_EQ(u.size(), 100000u + 66667u - 33334u);
+  EXPECT_EQ(i.size(), 33334u);
+  EXPECT_EQ(d.size(), 100000u - 33334u);
+  EXPECT_EQ(m.size(), u.size());
+  EXPECT_EQ(other.size(), i.size());
+  int expected = 0;
+  for (auto it = i.begin(); it != i.end(); ++it, expected += 6) {
+    ASSERT_EQ(*it, expected);
+  }
+}
+
+TEST(nodeHandle, test15) {
+  set<std::string> a{"apple", "pear", "plum"};
+  set<std::string> b{"fig"};
+  const std::string *address = &*a.find("pear");
+  set<std::string>::node_type node = a.extract("pear");
+  EXPECT_FALSE(node.empty());
+  EXPECT_EQ(node.value(), "pear");
+  EXPECT_EQ(a.size(), 2u);
+  EXPECT_FALSE(a.contains("pear"));
+  auto result = b.insert(std::move(node));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_TRUE(result.node.empty());
+  EXPECT_EQ(&*result.position, address);
+  EXPECT_EQ(b.size(), 2u);
+
+  node = a.extract(a.find("plum"));
+  EXPECT_EQ(node.value(), "plum");
+  EXPECT_TRUE(a.extract("kiwi").empty());
+  EXPECT_TRUE(a.extract(a.end()).empty());
+  a.insert("plum");
+  result = a.insert(std::move(node));
+  EXPECT_FALSE(result.inserted);
+  EXPECT_EQ(result.node.value(), "plum");
+  EXPECT_EQ(*result.position, "plum");
+  EXPECT_TRUE(b.insert(set<std::string>::node_type()).position == b.end());
+}
+
+TEST(nodeHandle, test16) {
+  set<int> a{1, 3, 5, 7};
+  set<int> b{3, 4, 5, 6};
+  const int *four = &*b.find(4);
+  a.merge(b);
+  EXPECT_EQ(a.size(), 6u);
+  EXPECT_EQ(&*a.find(4), four);
+  EXPECT_EQ(b.size(), 2u);
+  EXPECT_TRUE(b.contains(3) && b.contains(5));
+}
+
+TEST(swapClear, test17) {
+  set<int> a, b{-1};
+  for (int k = 0; k < 100000; ++k) a.insert(k * 7 % 100000);
+  const int *first = &*a.begin();
+  a.swap(b);
+  EXPECT_EQ(a.size(), 1u);
+  EXPECT_EQ(b.size(), 100000u);
+  EXPECT_EQ(&*b.begin(), first);
+  b.clear();
+  EXPECT_TRUE(b.empty());
+  EXPECT_TRUE(b.begin() == b.end());
+  b.insert(5);
+  EXPECT_EQ(*b.begin(), 5);
+  a.clear();
+  a.clear();
+  EXPECT_EQ(a.size(), 0u);
+}
+
+TEST(compareTest, test18) {
+  set<int, std::greater<int>> down{3, 1, 4, 5, 9, 2, 6};
+  int previous = 10;
+  for (auto it = down.begin(); it != down.end(); ++it) {
+    EXPECT_GT(previous, *it);
+    previous = *it;
+  }
+  EXPECT_EQ(*down.lower_bound(8), 6);
+  EXPECT_TRUE(down.lower_bound(0) == down.end());
+  EXPECT_EQ(down.erase(4), 1u);
+  EXPECT_EQ(down.erase(4), 0u);
+  EXPECT_EQ(down.count(5), 1u);
+}
+
+TEST(compareTest, test19) {
+  // std::string_view does not convert to std::string implicitly, so these
+  // only compile through the transparent overloads
+  set<std::string, std::less<>> words{"delta", "alpha", "charlie"};
+  std::string_view probe = "charlie";
+  EXPECT_TRUE(words.contains(probe));
+  EXPECT_EQ(*words.find(probe), "charlie");
+  EXPECT_EQ(words.count(std::string_view("bravo")), 0u);
+  EXPECT_EQ(*words.lower_bound(std::string_view("bravo")), "charlie");
+  EXPECT_EQ(words.erase(std::string_view("alpha")), 1u);
+  EXPECT_FALSE(words.contains(std::string_view("alpha")));
+  EXPECT_EQ(words.size(), 2u);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
 
@@ -0,0 +1,95 @@
+#include "../s21_simd.h"
+
+#include <gtest/gtest.h>
+
+#include "../s21_array.h"
+#include "../s21_vector.h"
+
+namespace {
+// runs body once per kernel set this CPU supports
+template <class F>
+void ForEachLevel(F body) {
+  for (auto level : {s21::simd::Level::kScalar, s21::simd::Level::kSse42,
+                     s21::simd::Level::kAvx2}) {
+    if (level > s21::simd::detected_level()) break;
+    s21::simd::set_level(level);
+    body();
+  }
+  s21::simd::set_level(s21::simd::detected_level());
+}
+}  // namespace
+
+TEST(SimdTest, find_and_contains) {
+  ForEachLevel([] {
+    s21::Vector<int32_t> v(1003);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = static_cast<int32_t>(i * 3);
+    for (int32_t x : {0, 3, 24, 1500, 3006}) {
+      auto it = s21::simd::find(v.begin(), v.end(), x);
+      ASSERT_NE(it, v.end());
+      EXPECT_EQ(*it, x);
+      EXPECT_EQ(it - v.begin(), x / 3);
+    }
+    EXPECT_EQ(s21::simd::find(v.begin(), v.end(), 4), v.end());
+    EXPECT_FALSE(s21::simd::contains(v.data(), v.data() + v.size(), 3009));
+    EXPECT_TRUE(s21::simd::contains(v.data(), v.data() + v.size(), 3006));
+  });
+}
+
+TEST(SimdTest, find_float) {
+  ForEachLevel([] {
+    s21::Vector<float> v(37);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = i * 0.5f;
+    EXPECT_EQ(s21::simd::find(v.begin(), v.end(), 17.5f) - v.begin(), 35);
+    EXPECT_EQ(s21::simd::find(v.begin(), v.end(), 0.25f), v.end());
+  });
+}
+
+TEST(SimdTest, count) {
+  ForEachLevel([] {
+    s21::Vector<int32_t> v(1001);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = static_cast<int32_t>(i % 7);
+    EXPECT_EQ(s21::simd::count(v.data(), v.data() + v.size(), 3), 143u);
+    s21::Vector<float> f = {1.f, 2.f, 1.f, 1.f, 5.f, 1.f, 1.f, 1.f, 1.f, 0.f};
+    EXPECT_EQ(s21::simd::count(f.data(), f.data() + f.size(), 1.f), 7u);
+  });
+}
+
+TEST(SimdTest, min_max) {
+  ForEachLevel([] {
+    s21::Vector<int32_t> v(999);
+    for (size_t i = 0; i < v.size(); ++i) {
+      v[i] = static_cast<int32_t>((i * 7919) % 1000) - 500;
+    }
+    EXPECT_EQ(s21::simd::min(v.data(), v.data() + v.size()), -500);
+    EXPECT_EQ(s21::simd::max(v.data(), v.data() + v.size()), 499);
+    s21::Array<float, 3> a = {2.5f, -1.f, 7.f};
+    auto range = s21::simd::minmax(a.begin(), a.end());
+    EXPECT_EQ(range.first, -1.f);
+    EXPECT_EQ(range.second, 7.f);
+    EXPECT_THROW(s21::simd::min(a.begin(), a.begin()), std::invalid_argument);
+  });
+}
+
+TEST(SimdTest, sum) {
+  ForEachLevel([] {
+    s21::Vector<int32_t> v(1000);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = 2000000000;
+    EXPECT_EQ(s21::simd::sum(v.data(), v.data() + v.size()), 2000000000000LL);
+    s21::Vector<float> f(101);
+    for (size_t i = 0; i < f.size(); ++i) f[i] = 0.5f;
+    EXPECT_DOUBLE_EQ(s21::simd::sum(f.data(), f.data() + f.size()), 50.5);
+    s21::Array<unsigned char, 4> bytes = {200, 200, 200, 200};
+    EXPECT_EQ(s21::simd::sum(bytes.begin(), bytes.end()), 800u);
+  });
+}
+
+TEST(SimdTest, fill) {
+  ForEachLevel([] {
+    s21::Vector<float> v(21);
+    s21::simd::fill(v.begin(), v.end(), 1.25f);
+    EXPECT_EQ(s21::simd::count(v.data(), v.data() + v.size(), 1.25f), 21u);
+    s21::Vector<double> d(5);
+    s21::simd::fill(d.begin(), d.end(), 2.0);
+    EXPECT_EQ(d[4], 2.0);
+  });
+}
@@ -4,6 +4,8 @@
 
 #include <stack>
 
+#include "../s21_deque.h"
+
 namespace s21 {
 TEST(Suite_Stack, Default_Constructor) {
   s21::Stack<int> s21_stack;
@@ -367,4 +369,16 @@ TEST(Suite_Stack, insert_many_front_Test) {
   EXPECT_EQ(my_stack.size(), 3u);
   EXPECT_EQ(my_stack.top(), 4u);
 }
-}  // namespace s21
\ No newline at end of file
+
+TEST(Suite_Stack, deque_container) {
+  s21::Stack<int, s21::Deque<int>> s{1, 2, 3};
+  for (int i = 4; i <= 1000; ++i) s.push(i);
+  s.insert_many_front(1001, 1002);
+  EXPECT_EQ(s.size(), 1002u);
+  for (int i = 1002; i > 0; --i) {
+    ASSERT_EQ(s.top(), i);
+    s.pop();
+  }
+  EXPECT_TRUE(s.empty());
+}
+}  // namespace s21
@@ -0,0 +1,109 @@
+#include "../s21_timer_wheel.h"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <map>
+#include <string>
+
+TEST(TimerWheelTest, fires_in_deadline_order) {
+  s21::TimerWheel<int> wheel;
+  for (int i : {5, 1, 300, 70000, 2, 5}) wheel.schedule(i, i);
+  EXPECT_EQ(wheel.size(), 6u);
+  s21::Vector<int> fired = wheel.advance(4);
+  ASSERT_EQ(fired.size(), 2u);
+  EXPECT_EQ(fired[0], 1);
+  EXPECT_EQ(fired[1], 2);
+  EXPECT_EQ(wheel.now(), 4u);
+
+  fired = wheel.advance(299);
+  ASSERT_EQ(fired.size(), 2u);
+  EXPECT_EQ(fired[0] + fired[1], 10);
+  fired = wheel.advance(300);
+  ASSERT_EQ(fired.size(), 1u);
+  EXPECT_EQ(fired[0], 300);
+  EXPECT_EQ(wheel.advance(69999).size(), 0u);
+  EXPECT_EQ(wheel.advance(70000).size(), 1u);
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, cancel_and_stale_handles) {
+  s21::TimerWheel<int> wheel(100);
+  auto a = wheel.schedule(150, 1);
+  auto b = wheel.schedule(50, 2);  // already due
+  auto c = wheel.schedule(100000, 3);
+  EXPECT_TRUE(wheel.cancel(c));
+  EXPECT_FALSE(wheel.cancel(c));
+  s21::Vector<int> fired = wheel.advance(101);
+  ASSERT_EQ(fired.size(), 1u);
+  EXPECT_EQ(fired[0], 2);
+  EXPECT_FALSE(wheel.cancel(b));
+  // b's slot is reused, but the old handle must not cancel the new timer
+  auto d = wheel.schedule(200, 4);
+  EXPECT_FALSE(wheel.cancel(b));
+  EXPECT_TRUE(wheel.cancel(a));
+  EXPECT_EQ(wheel.size(), 1u);
+  EXPECT_EQ(wheel.advance(1000).size(), 1u);
+  EXPECT_FALSE(wheel.cancel(d));
+}
+
+TEST(TimerWheelTest, matches_ordered_map_over_long_horizon) {
+  s21::TimerWheel<uint64_t> wheel;
+  std::multimap<uint64_t, uint64_t> expected;
+  unsigned seed = 3;
+  uint64_t now = 0;
+  for (int round = 0; round < 200; ++round) {
+    for (int i = 0; i < 50; ++i) {
+      seed = seed * 1103515245 + 12345;
+      // spread deadlines over every level and into the overflow bucket
+      uint64_t delay = uint64_t(seed >> 8) << ((seed >> 3) % 26);
+      wheel.schedule(now + delay, now + delay);
+      expected.emplace(now + delay, now + delay);
+    }
+    seed = seed * 1103515245 + 12345;
+    now += uint64_t(seed >> 4) << (round % 24);
+    uint64_t previous = 0;
+    size_t count = wheel.advance(now, [&](uint64_t& deadline) {
+      EXPECT_LE(deadline, now);
+      EXPECT_GE(deadline, previous);
+      previous = deadline;
+    });
+    size_t due = 0;
+    while (!expected.empty() && expected.begin()->first <= now) {
+      expected.erase(expected.begin());
+      ++due;
+    }
+    ASSERT_EQ(count, due) << "round " << round;
+    ASSERT_EQ(wheel.size(), expected.size());
+  }
+}
+
+TEST(TimerWheelTest, visitor_reschedules) {
+  s21::TimerWheel<int> wheel;
+  wheel.schedule(1, 0);
+  int runs = 0;
+  wheel.advance(10, [&](int& generation) {
+    ++runs;
+    if (generation < 100) wheel.schedule(wheel.now(), generation + 1);
+  });
+  EXPECT_EQ(runs, 10);
+  EXPECT_EQ(wheel.size(), 1u);
+  wheel.clear();
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(wheel.advance(100).size(), 0u);
+}
+
+TEST(TimerWheelTest, callback_payloads) {
+  s21::TimerWheel<std::function<void()>> wheel;
+  std::string log;
+  wheel.schedule(3, [&log] { log += "c"; });
+  wheel.schedule(1, [&log] { log += "a"; });
+  auto h = wheel.schedule(2, [&log] { log += "x"; });
+  wheel.schedule(2, [&log] { log += "b"; });
+  EXPECT_TRUE(wheel.cancel(h));
+  wheel.advance(5, [](std::function<void()>& callback) { callback(); });
+  EXPECT_EQ(log, "abc");
+  wheel.schedule(7, [&log] { log += "d"; });
+  for (auto& callback : wheel.advance(7)) callback();
+  EXPECT_EQ(log, "abcd");
+}
@@ -0,0 +1,89 @@
+#include "../s21_unrolled_list.h"
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <string>
+
+namespace {
+// Small blocks so that a few dozen elements already split and merge.
+using SmallList = s21::UnrolledList<int, 64>;
+
+template <class A, class B>
+void ExpectSame(const A& a, const B& b) {
+  ASSERT_EQ(a.size(), b.size());
+  auto it = b.begin();
+  for (const auto& value : a) EXPECT_EQ(value, *it++);
+}
+}  // namespace
+
+TEST(UnrolledListTest, push_and_pop_both_ends) {
+  SmallList l;
+  std::list<int> expected;
+  for (int i = 0; i < 100; ++i) {
+    l.push_back(i);
+    l.push_front(-i);
+    expected.push_back(i);
+    expected.push_front(-i);
+  }
+  ExpectSame(l, expected);
+  EXPECT_EQ(l.front(), -99);
+  EXPECT_EQ(l.back(), 99);
+  for (int i = 0; i < 150; ++i) {
+    l.pop_front();
+    expected.pop_front();
+  }
+  l.pop_back();
+  expected.pop_back();
+  ExpectSame(l, expected);
+  while (!l.empty()) l.pop_back();
+  EXPECT_TRUE(l.begin() == l.end());
+}
+
+TEST(UnrolledListTest, insert_and_erase_in_the_middle) {
+  SmallList l;
+  std::list<int> expected;
+  unsigned seed = 7;
+  for (int step = 0; step < 3000; ++step) {
+    seed = seed * 1103515245 + 12345;
+    size_t pos = l.empty() ? 0 : (seed >> 8) % (l.size() + 1);
+    auto it = l.begin();
+    auto jt = expected.begin();
+    for (size_t i = 0; i < pos; ++i, ++it, ++jt) {
+    }
+    if ((seed >> 4) % 3 != 0 || it == l.end()) {
+      EXPECT_EQ(*l.insert(it, step), step);
+      expected.insert(jt, step);
+    } else {
+      auto next = l.erase(it);
+      auto expected_next = expected.erase(jt);
+      if (expected_next == expected.end()) {
+        EXPECT_TRUE(next == l.end());
+      } else {
+        EXPECT_EQ(*next, *expected_next);
+      }
+    }
+  }
+  ExpectSame(l, expected);
+  auto back = l.end();
+  --back;
+  EXPECT_EQ(*back, expected.back());
+}
+
+TEST(UnrolledListTest, copy_move_and_compare) {
+  s21::UnrolledList<std::string> l = {"a", "b", "c"};
+  s21::UnrolledList<std::string> copy(l);
+  EXPECT_TRUE(copy == l);
+  copy.push_back("d");
+  EXPECT_TRUE(copy != l);
+  s21::UnrolledList<std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 4u);
+  EXPECT_EQ(moved.back(), "d");
+  l = moved;
+  EXPECT_TRUE(l == moved);
+  l.clear();
+  EXPECT_TRUE(l.empty());
+  l.push_front("z");
+  EXPECT_EQ(l.front(), "z");
+}
@@ -2,14 +2,21 @@
 #define S21_CONTAINERS_SRC_TREES_S21_BINARY_TREE_H_
 
 #include <cstddef>
+#include <functional>
 #include <iterator>
 #include <limits>
 #include <stdexcept>
 #include <utility>
 
+#include "../s21_serialization.h"
+#include "s21_tree_compare.h"
+
 namespace s21 {
 
-template <typename Key, typename T>
+// Keys are ordered by Compare alone. When Compare declares is_transparent,
+// find, contains, count, lower_bound and erase also take any key type it
+// can compare, so no Key has to be built for the lookup.
+template <typename Key, typename T, typename Compare = std::less<Key>>
 class BinaryTree {
   template <class Iter>
   class BinaryTreeIterator;
@@ -24,88 +31,164 @@ class BinaryTree {
   using iterator = BinaryTreeIterator<Node>;
   using const_iterator = BinaryTreeIterator<const Node>;
   using return_type = std::pair<iterator, bool>;
+  using key_compare = Compare;
+  class node_type;
+  struct insert_return_type;
 
-  explicit BinaryTree() noexcept : root(nullptr), treeSize(0) {}
+  explicit BinaryTree() noexcept : root(nullptr), treeSize(0), compare() {}
+  explicit BinaryTree(const Compare& comp)
+      : root(nullptr), treeSize(0), compare(comp) {}
   ~BinaryTree() { clear(this->root); }
   size_type size() { return this->treeSize; }
   size_type max_size();
   bool empty() { return this->size() == 0; }
   T& operator[](const Key& key) noexcept { return this->at(key); }
-  bool contains(const Key& key) { return contains(this->root, key); }
+  bool contains(const Key& key) { return findNode(key) != nullptr; }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K& key) {
+    return findNode(key) != nullptr;
+  }
+  size_type count(const Key& key) { return contains(key); }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type count(const K& key) {
+    return contains(key);
+  }
   void erase(iterator pos);
+  size_type erase(const Key& key) { return eraseKey(key); }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type erase(const K& key) {
+    return eraseKey(key);
+  }
   return_type insert(value_type value);
   return_type insert(const Key& key, const T& obj);
   return_type insert_or_assign(const Key& key, const T& obj);
-  typename Node::iterator begin() { return root->begin(); }
-  typename Node::const_iterator cbegin() const { return root->cbegin(); }
-  typename Node::iterator end() { return root->end(); }
-  typename Node::const_iterator cend() const { return root->cend(); }
-  typename Node::iterator find(const Key& key);
+  insert_return_type insert(node_type&& handle);
+  node_type extract(iterator pos);
+  node_type extract(const Key& key);
+  void merge(BinaryTree& other) noexcept;
+  iterator begin() { return iterator(firstNode(), &root); }
+  const_iterator cbegin() const { return const_iterator(firstNode(), &root); }
+  // Past the last entry; holds no node, so it never equals an entry's
+  // iterator, and stepping back from it reaches the last entry.
+  iterator end() { return iterator(nullptr, &root); }
+  const_iterator cend() const { return const_iterator(nullptr, &root); }
+  iterator find(const Key& key) { return lookup(key); }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K& key) {
+    return lookup(key);
+  }
+  iterator lower_bound(const Key& key) { return lowerBound(key); }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator lower_bound(const K& key) {
+    return lowerBound(key);
+  }
+  key_compare key_comp() const { return compare; }
   return_type insert(struct Node** node, struct Node** par, value_type value);
   T& at(const Key& key) { return at(this->root, key); }
   T& at(Node* node, const Key& key);
   bool contains(struct Node* node, const Key& key);
   void clear() { clear(this->root); }
 
+  void serialize(std::ostream& os);
+  size_type serialize(char* buffer, size_type size);
+  size_type serialized_size();
+  void deserialize(std::istream& is);
+  size_type deserialize(const char* buffer, size_type size);
+
  protected:
   Node* root;
   size_type treeSize;
+  Compare compare;
   void clear(struct Node* node);
   void copyUnique(Node* node_other);
 
  private:
   void transplant(Node* u, Node* v);
-  Node* findMinNode(Node* node);
+  void unlink(Node* node);
+  Node* attach(Node* node);
+  static Node* flatten(Node* node);
+  template <class K>
+  Node* findNode(const K& key) const {
+    return findFrom(this->root, key);
+  }
+  template <class K>
+  Node* findFrom(Node* node, const K& key) const;
+  template <class K>
+  Node* descend(const K& key, Node**& link, Node*& parent) const;
+  template <class K>
+  iterator lookup(const K& key);
+  template <class K>
+  iterator lowerBound(const K& key);
+  template <class K>
+  size_type eraseKey(const K& key);
+  static Node* findMinNode(Node* node);
+  Node* firstNode() const {
+    return root != nullptr ? findMinNode(root) : nullptr;
+  }
   return_type replace(const Key& key, const T& obj);
   return_type replace(Node* node, const Key& key, const T& obj);
+  static Node* nextNode(Node* node);
+  static void destroy(Node* node);
+  template <class Writer>
+  void save(Writer& writer);
+  template <class Reader>
+  void load(Reader& reader);
+  template <class Reader>
+  Node* buildSorted(Reader& reader, uint64_t n, const Key*& previous);
 };
 
-template <typename Key, typename T>
-struct BinaryTree<Key, T>::Node {
+template <typename Key, typename T, typename Compare>
+struct BinaryTree<Key, T, Compare>::Node {
   value_type data;
   struct Node* parent;
   struct Node* left;
   struct Node* right;
+};
 
-  mutable bool isEnd;
-
-  using iterator = BinaryTreeIterator<Node>;
-  using const_iterator = BinaryTreeIterator<const Node>;
+// Owns a node taken out of a tree by extract(), so that it can move to
+// another tree without being copied or reallocated. A non-empty handle
+// frees its node unless the node is inserted somewhere.
+template <typename Key, typename T, typename Compare>
+class BinaryTree<Key, T, Compare>::node_type {
+  friend class BinaryTree;
 
-  iterator begin() {
-    Node* node = this;
-    while (node->left != nullptr) node = node->left;
-    return iterator(node);
+ public:
+  node_type() noexcept : node(nullptr) {}
+  node_type(node_type&& other) noexcept : node(other.node) {
+    other.node = nullptr;
   }
-
-  iterator end() {
-    Node* node = this;
-    while (node->right != nullptr) {
-      node = node->right;
+  node_type& operator=(node_type&& other) noexcept {
+    if (this != &other) {
+      delete node;
+      node = other.node;
+      other.node = nullptr;
     }
-    node->isEnd = true;
-    return iterator(node);
+    return *this;
   }
+  ~node_type() { delete node; }
 
-  const_iterator cbegin() const {
-    const Node* node = this;
-    while (node->left != nullptr) node = node->left;
-    return const_iterator(node);
-  }
+  bool empty() const noexcept { return node == nullptr; }
+  explicit operator bool() const noexcept { return node != nullptr; }
+  const Key& key() const { return node->data.first; }
+  T& mapped() const { return node->data.second; }
+  void swap(node_type& other) noexcept { std::swap(node, other.node); }
 
-  const_iterator cend() const {
-    const Node* node = this;
-    while (node->right != nullptr) {
-      node = node->right;
-    }
-    node->isEnd = true;
-    return const_iterator(node);
-  }
+ private:
+  explicit node_type(Node* p) noexcept : node(p) {}
+
+  Node* node;
 };
 
-template <typename Key, typename T>
+template <typename Key, typename T, typename Compare>
+struct BinaryTree<Key, T, Compare>::insert_return_type {
+  iterator position;
+  bool inserted;
+  node_type node;
+};
+
+template <typename Key, typename T, typename Compare>
 template <class Iter>
-class BinaryTree<Key, T>::BinaryTreeIterator {
+class BinaryTree<Key, T, Compare>::BinaryTreeIterator {
   friend class BinaryTree;
 
  public:
@@ -115,16 +198,8 @@ class BinaryTree<Key, T>::BinaryTreeIterator {
 
   iterator_type* value;
 
-  iterator_type* find_root() {
-    if (value == nullptr) return nullptr;
-    value->isEnd = false;
-    while (value->parent != nullptr) {
-      value = value->parent;
-    }
-    return value;
-  }
-
-  BinaryTreeIterator(const BinaryTreeIterator& it) : value(it.value) {}
+  BinaryTreeIterator(const BinaryTreeIterator& it)
+      : value(it.value), root(it.root) {}
 
   bool operator!=(BinaryTreeIterator const& other) const noexcept {
     return value != other.value;
@@ -135,8 +210,8 @@ class BinaryTree<Key, T>::BinaryTreeIterator {
   }
 
   BinaryTreeIterator& operator++() {
-    if (value == nullptr || value->isEnd) {
-      value = find_root();
+    if (value == nullptr) {
+      value = treeRoot();
       if (value == nullptr) throw std::runtime_error("Empty Tree");
       while (value->left != nullptr) {
         value = value->left;
@@ -165,8 +240,8 @@ class BinaryTree<Key, T>::BinaryTreeIterator {
   }
 
   BinaryTreeIterator& operator--() {
-    if (value == nullptr || value->isEnd) {
-      value = find_root();
+    if (value == nullptr) {
+      value = treeRoot();
       if (value == nullptr) throw std::runtime_error("Empty Tree");
       while (value->right != nullptr) {
         value = value->right;
@@ -201,22 +276,33 @@ class BinaryTree<Key, T>::BinaryTreeIterator {
   BinaryTreeIterator& operator=(const BinaryTreeIterator& other) {
     if (this != &other) {
       this->value = other.value;
+      this->root = other.root;
     }
     return *this;
   }
 
  private:
-  BinaryTreeIterator(Iter* p) : value(p) {}
+  BinaryTreeIterator(Iter* p, Iter* const* tree) : value(p), root(tree) {}
+
+  iterator_type* treeRoot() const { return root != nullptr ? *root : nullptr; }
+
+  // The owning tree's root link, which end() steps back from.
+  Iter* const* root;
 };
 
-template <typename Key, typename T>
-void BinaryTree<Key, T>::erase(iterator pos) {
+template <typename Key, typename T, typename Compare>
+void BinaryTree<Key, T, Compare>::erase(iterator pos) {
   Node* node = pos.value;
+  // end(), as returned by a failed find(), erases nothing
+  if (node == nullptr) return;
 
-  if (node == nullptr) {
-    throw std::runtime_error("Invalid iterator");
-  }
+  unlink(node);
+  delete node;
+}
 
+// Takes node out of the tree, leaving it with no links.
+template <typename Key, typename T, typename Compare>
+void BinaryTree<Key, T, Compare>::unlink(Node* node) {
   if (node->left == nullptr) {
     transplant(node, node->right);
   } else if (node->right == nullptr) {
@@ -235,12 +321,89 @@ void BinaryTree<Key, T>::erase(iterator pos) {
     minRight->left->parent = minRight;
   }
 
-  delete node;
+  node->parent = node->left = node->right = nullptr;
   treeSize--;
 }
 
-template <typename Key, typename T>
-void BinaryTree<Key, T>::transplant(Node* u, Node* v) {
+// Hangs a detached node in key order and returns it. If the key is already
+// present, node is left alone and the node holding the key is returned.
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::Node*
+BinaryTree<Key, T, Compare>::attach(Node* node) {
+  Node* parent = nullptr;
+  Node** link = &this->root;
+  Node* found = descend(node->data.first, link, parent);
+  if (found != nullptr) return found;
+  node->parent = parent;
+  *link = node;
+  treeSize++;
+  return node;
+}
+
+// Threads the subtree into a list through the right links, in preorder.
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::Node*
+BinaryTree<Key, T, Compare>::flatten(Node* node) {
+  for (Node* at = node; at != nullptr; at = at->right) {
+    if (at->left == nullptr) continue;
+    Node* last = at->left;
+    while (last->right != nullptr) last = last->right;
+    last->right = at->right;
+    at->right = at->left;
+    at->left = nullptr;
+  }
+  return node;
+}
+
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::insert_return_type
+BinaryTree<Key, T, Compare>::insert(node_type&& handle) {
+  insert_return_type result{end(), false, std::move(handle)};
+  if (result.node.empty()) return result;
+  Node* node = attach(result.node.node);
+  result.position = iterator(node, &root);
+  result.inserted = node == result.node.node;
+  if (result.inserted) result.node.node = nullptr;
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::node_type
+BinaryTree<Key, T, Compare>::extract(iterator pos) {
+  if (pos.value == nullptr) return node_type();
+  unlink(pos.value);
+  return node_type(pos.value);
+}
+
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::node_type
+BinaryTree<Key, T, Compare>::extract(const Key& key) {
+  Node* node = findNode(key);
+  if (node == nullptr) return node_type();
+  unlink(node);
+  return node_type(node);
+}
+
+// Relinks the nodes of other whose keys are missing here; the rest go back
+// into other. Both trees take the nodes in other's preorder, which is the
+// order copyUnique() inserted in and rebuilds other's own shape, so no node
+// is allocated or copied and neither tree degenerates into a list.
+template <typename Key, typename T, typename Compare>
+void BinaryTree<Key, T, Compare>::merge(BinaryTree& other) noexcept {
+  if (&other == this) return;
+  Node* list = flatten(other.root);
+  other.root = nullptr;
+  other.treeSize = 0;
+  while (list != nullptr) {
+    Node* node = list;
+    list = list->right;
+    node->parent = node->right = nullptr;
+    if (attach(node) != node) other.attach(node);
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+void BinaryTree<Key, T, Compare>::transplant(Node* u, Node* v) {
   if (u->parent == nullptr) {
     root = v;
   } else if (u == u->parent->left) {
@@ -254,38 +417,35 @@ void BinaryTree<Key, T>::transplant(Node* u, Node* v) {
   }
 }
 
-template <typename Key, typename T>
-typename BinaryTree<Key, T>::Node* BinaryTree<Key, T>::findMinNode(Node* node) {
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::Node*
+BinaryTree<Key, T, Compare>::findMinNode(Node* node) {
   while (node->left != nullptr) {
     node = node->left;
   }
   return node;
 }
 
-template <typename Key, typename T>
-std::pair<typename BinaryTree<Key, T>::iterator, bool>
-BinaryTree<Key, T>::insert(value_type value) {
-  if (!this->contains(value.first)) {
-    return insert(&(this->root), &(this->root), value);
-  } else {
-    return std::make_pair(iterator(nullptr), false);
-  }
+template <typename Key, typename T, typename Compare>
+std::pair<typename BinaryTree<Key, T, Compare>::iterator, bool>
+BinaryTree<Key, T, Compare>::insert(value_type value) {
+  return insert(&(this->root), &(this->root), value);
 }
 
-template <typename Key, typename T>
-std::pair<typename BinaryTree<Key, T>::iterator, bool>
-BinaryTree<Key, T>::insert(const Key& key, const T& obj) {
+template <typename Key, typename T, typename Compare>
+std::pair<typename BinaryTree<Key, T, Compare>::iterator, bool>
+BinaryTree<Key, T, Compare>::insert(const Key& key, const T& obj) {
   return this->insert(&(this->root), &(this->root), std::make_pair(key, obj));
 }
 
-template <typename Key, typename T>
-std::pair<typename BinaryTree<Key, T>::iterator, bool>
-BinaryTree<Key, T>::replace(const Key& key, const T& obj) {
+template <typename Key, typename T, typename Compare>
+std::pair<typename BinaryTree<Key, T, Compare>::iterator, bool>
+BinaryTree<Key, T, Compare>::replace(const Key& key, const T& obj) {
   return replace(this->root, key, obj);
 }
 
-template <typename Key, typename T>
-void BinaryTree<Key, T>::copyUnique(Node* node_other) {
+template <typename Key, typename T, typename Compare>
+void BinaryTree<Key, T, Compare>::copyUnique(Node* node_other) {
   if (node_other == nullptr) {
     return;
   }
@@ -296,98 +456,130 @@ void BinaryTree<Key, T>::copyUnique(Node* node_other) {
   copyUnique(node_other->right);
 }
 
-template <typename Key, typename T>
-std::pair<typename BinaryTree<Key, T>::iterator, bool>
-BinaryTree<Key, T>::replace(Node* node, const Key& key, const T& obj) {
+template <typename Key, typename T, typename Compare>
+std::pair<typename BinaryTree<Key, T, Compare>::iterator, bool>
+BinaryTree<Key, T, Compare>::replace(Node* node, const Key& key, const T& obj) {
+  node = findFrom(node, key);
   if (node == NULL) {
     throw std::runtime_error("Invalid node");
-  } else {
-    if (key == node->data.first) {
-      node->data.second = obj;
-      return std::make_pair(iterator(node), true);
-    }
-    if (key > node->data.first) {
-      return replace(node->right, key, obj);
+  }
+  node->data.second = obj;
+  return std::make_pair(iterator(node, &root), true);
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename BinaryTree<Key, T, Compare>::iterator, bool>
+BinaryTree<Key, T, Compare>::insert_or_assign(const Key& key, const T& obj) {
+  return_type result = this->insert(key, obj);
+  if (!result.second) {
+    result.first.value->data.second = obj;
+    result.second = true;
+  }
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+template <class K>
+typename BinaryTree<Key, T, Compare>::Node*
+BinaryTree<Key, T, Compare>::findFrom(Node* node, const K& key) const {
+  Node* parent = nullptr;
+  Node** link = &node;
+  return descend(key, link, parent);
+}
+
+// Walks from *link down to the empty slot where key belongs, leaving link
+// at that slot and parent at its owner, and returns the node holding key
+// or nullptr. Each node costs one comparison. Keys with a three-way
+// compare() stop at the match. Otherwise the walk turns right past keys
+// ordered before key and left otherwise, so the last node it turned left
+// at is the first key not before key, and a final comparison tells
+// whether that one is key itself.
+template <typename Key, typename T, typename Compare>
+template <class K>
+typename BinaryTree<Key, T, Compare>::Node*
+BinaryTree<Key, T, Compare>::descend(const K& key, Node**& link,
+                                     Node*& parent) const {
+  Node* bound = nullptr;
+  while (*link != nullptr) {
+    parent = *link;
+    if constexpr (detail::kThreeWay<Compare, K, Key>) {
+      int order = detail::ThreeWay(key, parent->data.first);
+      if (order == 0) return parent;
+      link = order < 0 ? &parent->left : &parent->right;
+    } else if (compare(parent->data.first, key)) {
+      link = &parent->right;
     } else {
-      return replace(node->left, key, obj);
+      bound = parent;
+      link = &parent->left;
     }
   }
+  if (bound != nullptr && !compare(key, bound->data.first)) return bound;
+  return nullptr;
 }
 
-template <typename Key, typename T>
-std::pair<typename BinaryTree<Key, T>::iterator, bool>
-BinaryTree<Key, T>::insert_or_assign(const Key& key, const T& obj) {
-  if (this->contains(key)) {
-    return this->replace(key, obj);
-  } else {
-    return this->insert(key, obj);
-  }
+template <typename Key, typename T, typename Compare>
+template <class K>
+typename BinaryTree<Key, T, Compare>::iterator
+BinaryTree<Key, T, Compare>::lookup(const K& key) {
+  Node* node = findNode(key);
+  return node != nullptr ? iterator(node, &root) : this->end();
 }
 
-template <typename Key, typename T>
-typename BinaryTree<Key, T>::Node::iterator BinaryTree<Key, T>::find(
-    const Key& key) {
-  Node* node = this->root;
-  while (node != nullptr) {
-    if (key == node->data.first) {
-      return typename Node::iterator(node);
-    } else if (key > node->data.first) {
+// First entry whose key is not ordered before key, or end().
+template <typename Key, typename T, typename Compare>
+template <class K>
+typename BinaryTree<Key, T, Compare>::iterator
+BinaryTree<Key, T, Compare>::lowerBound(const K& key) {
+  Node* bound = nullptr;
+  for (Node* node = this->root; node != nullptr;) {
+    if (compare(node->data.first, key)) {
       node = node->right;
     } else {
+      bound = node;
       node = node->left;
     }
   }
-  return this->end();
+  return iterator(bound, &root);
 }
 
-template <typename Key, typename T>
-std::pair<typename BinaryTree<Key, T>::iterator, bool>
-BinaryTree<Key, T>::insert(Node** node, Node** par, value_type value) {
-  if (!*node) {
-    *node = new Node{value, *par, nullptr, nullptr, false};
-    this->treeSize++;
-    return {iterator(*node), true};
-  }
+template <typename Key, typename T, typename Compare>
+template <class K>
+typename BinaryTree<Key, T, Compare>::size_type
+BinaryTree<Key, T, Compare>::eraseKey(const K& key) {
+  Node* node = findNode(key);
+  if (node == nullptr) return 0;
+  unlink(node);
+  delete node;
+  return 1;
+}
 
-  return (value.first > (*node)->data.first)
-             ? insert(&(*node)->right, node, value)
-         : (value.first < (*node)->data.first)
-             ? insert(&(*node)->left, node, value)
-             : std::pair<iterator, bool>(iterator(*node), false);
+template <typename Key, typename T, typename Compare>
+std::pair<typename BinaryTree<Key, T, Compare>::iterator, bool>
+BinaryTree<Key, T, Compare>::insert(Node** node, Node** par, value_type value) {
+  Node* parent = par == node ? nullptr : *par;
+  Node* found = descend(value.first, node, parent);
+  if (found != nullptr) return {iterator(found, &root), false};
+  *node = new Node{value, parent, nullptr, nullptr};
+  this->treeSize++;
+  return {iterator(*node, &root), true};
 }
 
-template <typename Key, typename T>
-T& BinaryTree<Key, T>::at(Node* node, const Key& key) {
+template <typename Key, typename T, typename Compare>
+T& BinaryTree<Key, T, Compare>::at(Node* node, const Key& key) {
+  node = findFrom(node, key);
   if (node == nullptr) {
     throw std::runtime_error("Invalid node");
-  } else {
-    if (key == node->data.first) {
-      return node->data.second;
-    } else if (key > node->data.first) {
-      return at(node->right, key);
-    } else {
-      return at(node->left, key);
-    }
   }
+  return node->data.second;
 }
 
-template <typename Key, typename T>
-bool BinaryTree<Key, T>::contains(struct Node* node, const Key& key) {
-  if (node == nullptr) {
-    return false;
-  } else {
-    if (key == node->data.first) {
-      return true;
-    } else if (key > node->data.first) {
-      return contains(node->right, key);
-    } else {
-      return contains(node->left, key);
-    }
-  }
+template <typename Key, typename T, typename Compare>
+bool BinaryTree<Key, T, Compare>::contains(struct Node* node, const Key& key) {
+  return findFrom(node, key) != nullptr;
 }
 
-template <typename Key, typename T>
-void BinaryTree<Key, T>::clear(struct Node* node) {
+template <typename Key, typename T, typename Compare>
+void BinaryTree<Key, T, Compare>::clear(struct Node* node) {
   if (node != nullptr && treeSize > 0) {
     clear(node->left);
     clear(node->right);
@@ -396,9 +588,126 @@ void BinaryTree<Key, T>::clear(struct Node* node) {
   }
 }
 
-template <typename Key, typename T>
-typename BinaryTree<Key, T>::size_type BinaryTree<Key, T>::max_size() {
-  return std::numeric_limits<size_type>::max() / sizeof(BinaryTree<Key, T>) / 2;
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::size_type
+BinaryTree<Key, T, Compare>::max_size() {
+  return std::numeric_limits<size_type>::max() / sizeof(BinaryTree) / 2;
+}
+
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::Node*
+BinaryTree<Key, T, Compare>::nextNode(Node* node) {
+  if (node->right != nullptr) {
+    node = node->right;
+    while (node->left != nullptr) node = node->left;
+    return node;
+  }
+  while (node->parent != nullptr && node == node->parent->right) {
+    node = node->parent;
+  }
+  return node->parent;
+}
+
+template <typename Key, typename T, typename Compare>
+void BinaryTree<Key, T, Compare>::destroy(Node* node) {
+  if (node != nullptr) {
+    destroy(node->left);
+    destroy(node->right);
+    delete node;
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+void BinaryTree<Key, T, Compare>::serialize(std::ostream& os) {
+  serialization::StreamWriter writer(os);
+  save(writer);
+}
+
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::size_type
+BinaryTree<Key, T, Compare>::serialize(char* buffer, size_type size) {
+  serialization::BufferWriter writer(buffer, size);
+  save(writer);
+  return writer.count();
+}
+
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::size_type
+BinaryTree<Key, T, Compare>::serialized_size() {
+  serialization::SizeCounter writer;
+  save(writer);
+  return writer.count();
+}
+
+template <typename Key, typename T, typename Compare>
+void BinaryTree<Key, T, Compare>::deserialize(std::istream& is) {
+  serialization::StreamReader reader(is);
+  load(reader);
+}
+
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::size_type
+BinaryTree<Key, T, Compare>::deserialize(const char* buffer, size_type size) {
+  serialization::BufferReader reader(buffer, size);
+  load(reader);
+  return reader.count();
+}
+
+template <typename Key, typename T, typename Compare>
+template <class Writer>
+void BinaryTree<Key, T, Compare>::save(Writer& writer) {
+  serialization::WriteHeader(writer, this->treeSize);
+  if (this->root == nullptr) return;
+  for (Node* node = findMinNode(this->root); node != nullptr;
+       node = nextNode(node)) {
+    serialization::WriteValue(writer, node->data);
+  }
+}
+
+// Entries are stored in key order, so the tree is rebuilt balanced in O(n)
+// instead of n inserts.
+template <typename Key, typename T, typename Compare>
+template <class Reader>
+void BinaryTree<Key, T, Compare>::load(Reader& reader) {
+  uint64_t n = serialization::ReadHeader<value_type>(reader);
+  const Key* previous = nullptr;
+  Node* built = buildSorted(reader, n, previous);
+  clear();
+  this->root = built;
+  this->treeSize = n;
+}
+
+template <typename Key, typename T, typename Compare>
+template <class Reader>
+typename BinaryTree<Key, T, Compare>::Node*
+BinaryTree<Key, T, Compare>::buildSorted(Reader& reader, uint64_t n,
+                                         const Key*& previous) {
+  if (n == 0) return nullptr;
+  Node* left = buildSorted(reader, n / 2, previous);
+  Node* node = nullptr;
+  try {
+    Key key;
+    T obj;
+    serialization::ReadValue(reader, key);
+    serialization::ReadValue(reader, obj);
+    if (previous != nullptr && !compare(*previous, key))
+      throw std::invalid_argument("keys are not strictly ascending");
+    node = new Node{value_type(std::move(key), std::move(obj)), nullptr, left,
+                    nullptr};
+  } catch (...) {
+    destroy(left);
+    throw;
+  }
+  if (left != nullptr) left->parent = node;
+  previous = &node->data.first;
+  try {
+    node->right = buildSorted(reader, n - n / 2 - 1, previous);
+  } catch (...) {
+    destroy(node);
+    throw;
+  }
+  if (node->right != nullptr) node->right->parent = node;
+  return node;
 }
 
 }  // namespace s21
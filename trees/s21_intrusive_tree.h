@@ -0,0 +1,315 @@
+#ifndef S21_CONTAINERS_SRC_TREES_S21_INTRUSIVE_TREE_H_
+#define S21_CONTAINERS_SRC_TREES_S21_INTRUSIVE_TREE_H_
+
+#include <cstddef>
+#include <type_traits>
+
+namespace s21 {
+
+// Red-black links embedded in an element. Null children stand for the black
+// leaves; a detached hook has every pointer null.
+struct RbHook {
+  RbHook* parent = nullptr;
+  RbHook* leftChild = nullptr;
+  RbHook* rightChild = nullptr;
+  bool isBlack = false;
+};
+
+// Augmentation policy that keeps nothing. A real one is called as
+// augment(node) whenever node's subtree may have changed, after node's
+// children are up to date, and recomputes whatever node caches about its
+// subtree (the largest endpoint below it, a count, ...).
+struct RbNoAugment {
+  void operator()(RbHook*) const noexcept {}
+};
+
+// Red-black tree algorithms working purely on hooks. They never allocate and
+// never look at the elements, so ordering is the caller's business: find the
+// attach point, call Link(), and Erase() later without any search.
+//
+// Link, Erase and the rotations take an optional augmentation policy; the
+// Join family does not, so augmented trees must stick to the former.
+struct RbTree {
+  static RbHook* MinFromHere(RbHook* node) {
+    while (node->leftChild) node = node->leftChild;
+    return node;
+  }
+
+  static RbHook* MaxFromHere(RbHook* node) {
+    while (node->rightChild) node = node->rightChild;
+    return node;
+  }
+
+  static RbHook* Next(RbHook* node) {
+    if (node->rightChild) return MinFromHere(node->rightChild);
+    while (node->parent && node->parent->rightChild == node) {
+      node = node->parent;
+    }
+    return node->parent;
+  }
+
+  static RbHook* Previous(RbHook* node) {
+    if (node->leftChild) return MaxFromHere(node->leftChild);
+    while (node->parent && node->parent->leftChild == node) {
+      node = node->parent;
+    }
+    return node->parent;
+  }
+
+  // Hangs node below parent (or makes it the root when parent is null) and
+  // restores the red-black invariants.
+  template <typename Augment = RbNoAugment>
+  static void Link(RbHook*& root, RbHook* parent, bool left, RbHook* node,
+                   Augment augment = Augment()) {
+    node->parent = parent;
+    node->leftChild = node->rightChild = nullptr;
+    if (!parent) {
+      root = node;
+    } else if (left) {
+      parent->leftChild = node;
+    } else {
+      parent->rightChild = node;
+    }
+    Propagate(node, augment);
+    FixAfterInsert(root, node, augment);
+  }
+
+  // Unlinks node from the tree rooted at root. At most three rotations.
+  template <typename Augment = RbNoAugment>
+  static void Erase(RbHook*& root, RbHook* node, Augment augment = Augment()) {
+    RbHook* child;
+    RbHook* child_parent;
+    bool removed_black = node->isBlack;
+    if (!node->leftChild || !node->rightChild) {
+      child = node->leftChild ? node->leftChild : node->rightChild;
+      child_parent = node->parent;
+      Replace(root, node, child);
+    } else {
+      // splice the successor into node's place
+      RbHook* next = MinFromHere(node->rightChild);
+      removed_black = next->isBlack;
+      child = next->rightChild;
+      if (next->parent == node) {
+        child_parent = next;
+      } else {
+        child_parent = next->parent;
+        Replace(root, next, child);
+        next->rightChild = node->rightChild;
+        next->rightChild->parent = next;
+      }
+      Replace(root, node, next);
+      next->leftChild = node->leftChild;
+      next->leftChild->parent = next;
+      next->isBlack = node->isBlack;
+    }
+    Propagate(child_parent, augment);
+    if (removed_black) FixAfterErase(root, child, child_parent, augment);
+    node->parent = node->leftChild = node->rightChild = nullptr;
+  }
+
+  // Makes node the black root of a standalone tree; null stays null.
+  static RbHook* Detach(RbHook* node) {
+    if (node) {
+      node->parent = nullptr;
+      node->isBlack = true;
+    }
+    return node;
+  }
+
+  // Black nodes on any root-to-leaf path, null leaves not counted.
+  static size_t BlackHeight(const RbHook* node) {
+    size_t height = 0;
+    for (; node; node = node->leftChild) height += node->isBlack;
+    return height;
+  }
+
+  // Joins two trees around middle, every element of left ordering before
+  // middle and every element of right after it. Descends the taller tree's
+  // inner spine to the black height of the shorter one and hangs middle
+  // there, so the cost is O(|height(left) - height(right)| + 1).
+  static RbHook* Join(RbHook* left, RbHook* middle, RbHook* right) {
+    Detach(left);
+    Detach(right);
+    size_t left_height = BlackHeight(left);
+    size_t right_height = BlackHeight(right);
+    middle->parent = nullptr;
+    if (left_height == right_height) {
+      Attach(middle, left, right);
+      middle->isBlack = true;
+      return middle;
+    }
+    bool descend_left = left_height < right_height;
+    RbHook* root = descend_left ? right : left;
+    size_t target = descend_left ? left_height : right_height;
+    size_t height = descend_left ? right_height : left_height;
+    RbHook* parent = nullptr;
+    RbHook* node = root;
+    while (node && !(node->isBlack && height == target)) {
+      height -= node->isBlack;
+      parent = node;
+      node = descend_left ? node->leftChild : node->rightChild;
+    }
+    if (descend_left) {
+      Attach(middle, left, node);
+      parent->leftChild = middle;
+    } else {
+      Attach(middle, node, right);
+      parent->rightChild = middle;
+    }
+    middle->parent = parent;
+    FixAfterInsert(root, middle);
+    return root;
+  }
+
+  // Join without a middle element: borrows the largest node of left.
+  static RbHook* JoinTwo(RbHook* left, RbHook* right) {
+    if (!left) return Detach(right);
+    Detach(left);
+    RbHook* middle = MaxFromHere(left);
+    Erase(left, middle);
+    return Join(left, middle, right);
+  }
+
+  template <typename Augment = RbNoAugment>
+  static void RotateLeft(RbHook*& root, RbHook* node,
+                         Augment augment = Augment()) {
+    RbHook* pivot = node->rightChild;
+    node->rightChild = pivot->leftChild;
+    if (pivot->leftChild) pivot->leftChild->parent = node;
+    Replace(root, node, pivot);
+    pivot->leftChild = node;
+    node->parent = pivot;
+    augment(node);
+    augment(pivot);
+  }
+
+  template <typename Augment = RbNoAugment>
+  static void RotateRight(RbHook*& root, RbHook* node,
+                          Augment augment = Augment()) {
+    RbHook* pivot = node->leftChild;
+    node->leftChild = pivot->rightChild;
+    if (pivot->rightChild) pivot->rightChild->parent = node;
+    Replace(root, node, pivot);
+    pivot->rightChild = node;
+    node->parent = pivot;
+    augment(node);
+    augment(pivot);
+  }
+
+ private:
+  static bool IsBlack(const RbHook* node) { return !node || node->isBlack; }
+
+  // Refreshes node and every ancestor, bottom up.
+  template <typename Augment>
+  static void Propagate(RbHook* node, Augment& augment) {
+    if constexpr (!std::is_same_v<Augment, RbNoAugment>) {
+      for (; node; node = node->parent) augment(node);
+    }
+  }
+
+  static void Attach(RbHook* node, RbHook* left, RbHook* right) {
+    node->leftChild = left;
+    node->rightChild = right;
+    if (left) left->parent = node;
+    if (right) right->parent = node;
+  }
+
+  // Puts with in place of node under node's parent.
+  static void Replace(RbHook*& root, RbHook* node, RbHook* with) {
+    if (!node->parent) {
+      root = with;
+    } else if (node->parent->leftChild == node) {
+      node->parent->leftChild = with;
+    } else {
+      node->parent->rightChild = with;
+    }
+    if (with) with->parent = node->parent;
+  }
+
+  template <typename Augment = RbNoAugment>
+  static void FixAfterInsert(RbHook*& root, RbHook* node,
+                             Augment augment = Augment()) {
+    node->isBlack = false;
+    while (node != root && !node->parent->isBlack) {
+      RbHook* parent = node->parent;
+      RbHook* grand = parent->parent;
+      bool left = parent == grand->leftChild;
+      RbHook* uncle = left ? grand->rightChild : grand->leftChild;
+      if (!IsBlack(uncle)) {
+        parent->isBlack = uncle->isBlack = true;
+        grand->isBlack = false;
+        node = grand;
+        continue;
+      }
+      if (left && node == parent->rightChild) {
+        RotateLeft(root, parent, augment);
+        parent = node;
+      } else if (!left && node == parent->leftChild) {
+        RotateRight(root, parent, augment);
+        parent = node;
+      }
+      parent->isBlack = true;
+      grand->isBlack = false;
+      if (left) {
+        RotateRight(root, grand, augment);
+      } else {
+        RotateLeft(root, grand, augment);
+      }
+      break;
+    }
+    root->isBlack = true;
+  }
+
+  // node carries an extra black; it may be null, hence the explicit parent.
+  template <typename Augment>
+  static void FixAfterErase(RbHook*& root, RbHook* node, RbHook* parent,
+                            Augment augment) {
+    while (node != root && IsBlack(node)) {
+      bool left = node == parent->leftChild;
+      RbHook* sibling = left ? parent->rightChild : parent->leftChild;
+      if (!sibling->isBlack) {
+        sibling->isBlack = true;
+        parent->isBlack = false;
+        if (left) {
+          RotateLeft(root, parent, augment);
+        } else {
+          RotateRight(root, parent, augment);
+        }
+        sibling = left ? parent->rightChild : parent->leftChild;
+      }
+      RbHook* near = left ? sibling->leftChild : sibling->rightChild;
+      RbHook* far = left ? sibling->rightChild : sibling->leftChild;
+      if (IsBlack(near) && IsBlack(far)) {
+        sibling->isBlack = false;
+        node = parent;
+        parent = node->parent;
+        continue;
+      }
+      if (IsBlack(far)) {
+        near->isBlack = true;
+        sibling->isBlack = false;
+        if (left) {
+          RotateRight(root, sibling, augment);
+        } else {
+          RotateLeft(root, sibling, augment);
+        }
+        far = sibling;
+        sibling = near;
+      }
+      sibling->isBlack = parent->isBlack;
+      parent->isBlack = true;
+      far->isBlack = true;
+      if (left) {
+        RotateLeft(root, parent, augment);
+      } else {
+        RotateRight(root, parent, augment);
+      }
+      node = root;
+    }
+    if (node) node->isBlack = true;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_TREES_S21_INTRUSIVE_TREE_H_
@@ -1,131 +1,87 @@
 #ifndef S21_CONTAINERS_SRC_TREES_S21_RED_BLACK_TREE_H_
 #define S21_CONTAINERS_SRC_TREES_S21_RED_BLACK_TREE_H_
 
+#include <cstddef>
+#include <functional>
 #include <iostream>
-template <typename K, typename V>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_intrusive_tree.h"
+#include "s21_tree_compare.h"
+
+// Keys are ordered by Compare alone; two keys are equal when neither
+// compares less than the other.
+template <typename K, typename V, typename Compare = std::less<K>>
 class RedBlackTree {
  public:
-  class Node {
+  // The links and colour live in the RbHook base, so balancing, join and
+  // split all go through the shared s21::RbTree algorithms.
+  class Node : public s21::RbHook {
    public:
-    Node(K key_, V value_)
-        : key_(key_),
-          value_(value_),
-          isBlack_(false),
-          isLeftChild_(false),
-          leftChild(nullptr),
-          rightChild(nullptr),
-          parent(nullptr){};
-
-    Node(Node &other)
-        : key_(other.key_),
-          value_(other.value_),
-          isBlack_(other.isBlack_),
-          isLeftChild_(other.isLeftChild_),
-          leftChild(other.leftChild),
-          rightChild(other.rightChild),
-          parent(other.parent){};
-
-    Node(Node &&other) { *this = std::move(other); };
-
-    Node &operator=(const Node &other) {
-      Node temp(other);
-      *this = std::move(temp);
-      return *this;
-    };
-
-    Node &operator=(Node &&other) noexcept {
-      std::swap(key_, other.key_);
-      std::swap(value_, other.value_);
-      std::swap(isBlack_, other.isBlack_);
-      std::swap(isLeftChild_, other.isLeftChild_);
-      std::swap(leftChild, other.leftChild);
-      std::swap(rightChild, other.rightChild);
-      std::swap(parent, other.parent);
-      return *this;
-    };
+    Node(K key_, V value_) : key_(key_), value_(value_){};
 
-    ~Node() {
-      delete rightChild;
-      delete leftChild;
+    Node(const Node &other)
+        : s21::RbHook(), key_(other.key_), value_(other.value_) {
+      isBlack = other.isBlack;
     };
 
     void CopyTree(Node *other) {
       if (other != NULL) {
-        // if (node -> parent == NULL)
         if (other->rightChild != NULL) {
-          Node *n_node = new Node(*(other->rightChild));
+          Node *n_node = new Node(*AsNode(other->rightChild));
           n_node->parent = this;
           rightChild = n_node;
-          rightChild->CopyTree(other->rightChild);
+          n_node->CopyTree(AsNode(other->rightChild));
         }
         if (other->leftChild != NULL) {
-          Node *n_node = new Node(*(other->leftChild));
+          Node *n_node = new Node(*AsNode(other->leftChild));
           n_node->parent = this;
           leftChild = n_node;
-          leftChild->CopyTree(other->leftChild);
+          n_node->CopyTree(AsNode(other->leftChild));
         }
       }
     }
 
-    Node *Next() {
-      Node *temp = this;
-      if (!temp) return temp;
-      if (rightChild) {
-        temp = rightChild;
-        temp = temp->MinFromHere();
-        return temp;
-      }
-      if (isLeftChild_) return parent;
-      return rightChild;
-    }
+    Node *Next() { return AsNode(s21::RbTree::Next(this)); }
+    const Node *Next() const { return const_cast<Node *>(this)->Next(); }
 
-    Node *Previous() {
-      Node *temp = NULL;
-      if (leftChild) {
-        temp = leftChild;
-        temp = temp->MaxFromHere();
-        return temp;
-      }
-      return NULL;
+    Node *Previous() { return AsNode(s21::RbTree::Previous(this)); }
+    const Node *Previous() const {
+      return const_cast<Node *>(this)->Previous();
     }
 
-    Node *MaxFromHere() {
-      Node *temp = this;
-      while (temp && temp->rightChild) {
-        temp = temp->rightChild;
-      }
-      return temp;
-    };
+    Node *MaxFromHere() { return AsNode(s21::RbTree::MaxFromHere(this)); };
 
-    Node *MinFromHere() {
-      Node *temp = this;
-      while (temp && temp->leftChild) {
-        temp = temp->leftChild;
-      }
-      return temp;
-    }
+    Node *MinFromHere() { return AsNode(s21::RbTree::MinFromHere(this)); }
+
+    const K &Key() const { return key_; }
+
+    V &Value() { return value_; }
+    const V &Value() const { return value_; }
 
    private:
     friend class RedBlackTree;
     const K key_;
     V value_;
-    bool isBlack_;
-    /* if a node's parent is a left child then we are going to look
-        for a node's aunt on the right side from our grandfather*/
-    bool isLeftChild_;
-    Node *leftChild, *rightChild, *parent;
-    // if parent is NULL then we are dealing with a root node
   };
 
-  RedBlackTree() : size_(0), root_(nullptr){};
-  RedBlackTree(K key, V value) : size_(1), root_(new Node(key, value)){};
+  RedBlackTree() : size_(0), root_(nullptr), compare_(){};
+  explicit RedBlackTree(const Compare &compare)
+      : size_(0), root_(nullptr), compare_(compare){};
+  RedBlackTree(K key, V value)
+      : size_(1), root_(new Node(key, value)), compare_() {
+    root_->isBlack = true;
+  };
   RedBlackTree(const RedBlackTree &other)
-      : size_(other.size_),
-        root_(new Node(other.root_->key_, other.root_->value_)) {
-    root_->isBlack_ = true;
-    root_->CopyTree(other.root_);
+      : size_(other.size_), root_(NULL), compare_(other.compare_) {
+    if (other.root_ == NULL) return;
+    Node *root = new Node(*AsNode(other.root_));
+    root->CopyTree(AsNode(other.root_));
+    root_ = root;
   }
-  RedBlackTree(RedBlackTree &&other) : size_(0), root_(nullptr) {
+  RedBlackTree(RedBlackTree &&other)
+      : size_(0), root_(nullptr), compare_(other.compare_) {
     *this = std::move(other);
   };
 
@@ -138,355 +94,197 @@ class RedBlackTree {
   RedBlackTree &operator=(RedBlackTree &&other) noexcept {
     std::swap(root_, other.root_);
     std::swap(size_, other.size_);
+    std::swap(compare_, other.compare_);
     return *this;
   }
 
-  ~RedBlackTree() {
-    if (root_ != NULL) delete root_;
-  };
-
-  void AddNode(Node *other) { AddNode(other->key_, other->value_); }
+  ~RedBlackTree() { Destroy(root_); };
 
-  void AddNode(K key, V value) {
-    if (FindNode(key) == NULL) {
-      Node *node = new Node(key, value);
-      if (root_ == NULL) {
-        root_ = node;  //
-        root_->isBlack_ = true;
-        size_ += 1;
-        return;
-      }
-      size_ += 1;
-      AddNode(root_, node);
-    }
-  };
-
-  void DeleteNode(K key) {
-    Node *removeThis = FindNode(key);
-    Node *change = NULL;
-    if (!removeThis) return;
-    size_ -= 1;
-    if (!removeThis->leftChild) {
-      change = removeThis->rightChild;
-      Transplantation(removeThis, change);
-    } else if (!removeThis->rightChild) {
-      change = removeThis->leftChild;
-      Transplantation(removeThis, change);
-    } else {
-      change = removeThis->Previous();
-      Transplantation(change, change->leftChild);
-      change->leftChild = removeThis->leftChild;
-      change->rightChild = removeThis->rightChild;
-      if (change->leftChild) change->leftChild->parent = change;
-      if (change->rightChild) change->rightChild->parent = change;
-      Transplantation(removeThis, change);
-    }
-    if (change) {
-      change->isLeftChild_ = removeThis->isLeftChild_;
-    }
-    if (change) FixAfterDelete(change);
-    removeThis->rightChild = removeThis->leftChild = removeThis->parent = NULL;
-    delete removeThis;
+  int Height(Node *node) {
+    if (node == NULL) return 0;
+    int leftHeight = 0, rightHeight = 0;
+    leftHeight = Height(AsNode(node->leftChild)) + 1;
+    rightHeight = Height(AsNode(node->rightChild)) + 1;
+    if (leftHeight > rightHeight) return leftHeight;
+    return rightHeight;
   }
 
-  void Transplantation(Node *dad, Node *child) {
-    if (dad == root_) {
-      root_ = child;
-    } else if (dad->isLeftChild_) {
-      dad->parent->leftChild = child;
-    } else {
-      dad->parent->rightChild = child;
-    }
-    if (child) child->parent = dad->parent;
+  int Height() {
+    if (root_ == NULL) return 0;
+    return Height(AsNode(root_)) - 1;
   }
 
-  void FixAfterDelete(Node *node) {
-    while (node != root_ && (node == NULL || node->isBlack_)) {
-      if (node == node->parent->leftChild) {
-        Node *sibling = node->parent->rightChild;
-        if (sibling == NULL) return;
-
-        if (!sibling->isBlack_) {
-          sibling->isBlack_ = true;
-          node->parent->isBlack_ = false;
-          LeftRotate(node->parent);
-          sibling = node->parent->rightChild;
-        }
-
-        if ((sibling->leftChild == NULL || sibling->leftChild->isBlack_) &&
-            (sibling->rightChild == NULL || sibling->rightChild->isBlack_)) {
-          sibling->isBlack_ = false;
-          node = node->parent;
-        } else {
-          if (sibling->rightChild == NULL || sibling->rightChild->isBlack_) {
-            if (sibling->leftChild != NULL) sibling->leftChild->isBlack_ = true;
-            sibling->isBlack_ = false;
-            RightRotate(sibling);
-            sibling = node->parent->rightChild;
-          }
-
-          sibling->isBlack_ = node->parent->isBlack_;
-          node->parent->isBlack_ = true;
-          if (sibling->rightChild != NULL) sibling->rightChild->isBlack_ = true;
-          LeftRotate(node->parent);
-          node = root_;
-        }
-      } else {
-        Node *sibling = node->parent->leftChild;
-        if (sibling == NULL) return;
-
-        if (!sibling->isBlack_) {
-          sibling->isBlack_ = true;
-          node->parent->isBlack_ = false;
-          RightRotate(node->parent);
-          sibling = node->parent->leftChild;
-        }
-
-        if ((sibling->leftChild == NULL || sibling->leftChild->isBlack_) &&
-            (sibling->rightChild == NULL || sibling->rightChild->isBlack_)) {
-          sibling->isBlack_ = false;
-          node = node->parent;
-        } else {
-          if (sibling->leftChild == NULL || sibling->leftChild->isBlack_) {
-            if (sibling->rightChild != NULL)
-              sibling->rightChild->isBlack_ = true;
-            sibling->isBlack_ = false;
-            LeftRotate(sibling);
-            sibling = node->parent->leftChild;
-          }
-
-          sibling->isBlack_ = node->parent->isBlack_;
-          node->parent->isBlack_ = true;
-          if (sibling->leftChild != NULL) sibling->leftChild->isBlack_ = true;
-          RightRotate(node->parent);
-          node = root_;
-        }
-      }
-    }
-
-    if (node != NULL) {
-      node->isBlack_ = true;
-    }
+  int CountBlack() {
+    if (root_ == NULL) return 1;
+    return CountBlack(AsNode(root_)) - 1;
   }
 
-  Node *Sibling(Node *node) {
-    if (node->isLeftChild_) return node->parent->rightChild;
-    return node->parent->leftChild;
+  // Black height of the subtree plus one, or -1 when the red-black
+  // invariants are broken anywhere below node.
+  int CountBlack(Node *node) {
+    if (node == NULL) return 1;
+    if (!node->isBlack && (IsRed(node->leftChild) || IsRed(node->rightChild)))
+      return -1;
+    int rightSideBlacks = CountBlack(AsNode(node->rightChild));
+    int leftSideBlacks = CountBlack(AsNode(node->leftChild));
+    if (rightSideBlacks != leftSideBlacks || leftSideBlacks == -1) {
+      return -1;
+    };
+    if (node->isBlack) leftSideBlacks++;
+    return leftSideBlacks;
   }
 
-  void TreeCorrection(Node *node) {
-    if (node->parent->isLeftChild_) {  // aunt is right-wing
-      if (node->parent->parent->rightChild == NULL ||
-          node->parent->parent->rightChild->isBlack_)
-        return DoRotation(node);
-      if (node->parent->parent->rightChild != NULL) {
-        node->parent->parent->rightChild->isBlack_ = true;
-        node->parent->parent->isBlack_ = false;
-        node->parent->isBlack_ = true;
-        return;
-      }
-    } else {  // our aunt is a leftie
-      if (node->parent->parent->leftChild == NULL ||
-          node->parent->parent->leftChild->isBlack_)
-        return DoRotation(node);
-      if (node->parent->parent->leftChild != NULL) {
-        node->parent->parent->leftChild->isBlack_ = true;
-        node->parent->parent->isBlack_ = false;
-        node->parent->isBlack_ = true;
-        return;
+  // Lookups take any key type Compare accepts, so a transparent comparator
+  // can search without building a K.
+  template <typename Key>
+  Node *FindNode(const Key &key) {
+    if constexpr (s21::detail::kThreeWay<Compare, Key, K>) {
+      s21::RbHook *node = root_;
+      while (node != NULL) {
+        int order = s21::detail::ThreeWay(key, AsNode(node)->key_);
+        if (order == 0) return AsNode(node);
+        node = order < 0 ? node->leftChild : node->rightChild;
       }
+      return NULL;
+    } else {
+      return FindFirst(key);
     }
   }
 
-  void CheckColor(Node *newNode) {
-    if (newNode == root_) return;
-    if (!newNode->isBlack_ && !newNode->parent->isBlack_) {
-      TreeCorrection(newNode);
-      root_->isBlack_ = true;
-      root_->parent = NULL;
-    }
-    CheckColor(newNode->parent);
-  };
-
-  void DoRotation(Node *node) {
-    if (node == NULL) return;
-    if (node->isLeftChild_) {
-      if (node->parent->isLeftChild_) {
-        RightRotate(node->parent->parent);
-        node->isBlack_ = false;
-        if (node->parent->rightChild != NULL)
-          node->parent->rightChild->isBlack_ = false;
-        node->parent->isBlack_ = true;
-        return;
+  // First node whose key does not compare less than key, or NULL. Costs
+  // one comparison per level, where testing for equality on the way down
+  // would cost two.
+  template <typename Key>
+  Node *LowerBound(const Key &key) {
+    s21::RbHook *node = root_;
+    s21::RbHook *bound = NULL;
+    while (node != NULL) {
+      if (compare_(AsNode(node)->key_, key)) {
+        node = node->rightChild;
       } else {
-        RightLeftRotate(node->parent->parent);
-        node->isBlack_ = true;
-        if (node->rightChild != NULL) node->rightChild->isBlack_ = false;
-        if (node->leftChild != NULL) node->leftChild->isBlack_ = false;
-        return;
-      }
-    } else {
-      if (!node->parent->isLeftChild_) {
-        LeftRotate(node->parent->parent);
-        node->isBlack_ = false;
-        node->parent->isBlack_ = true;
-        if (node->parent->leftChild != NULL)
-          node->parent->leftChild->isBlack_ = false;
-        return;
-      } else {
-        LeftRightRotate(node->parent->parent);
-        node->isBlack_ = false;
-        if (node->rightChild != NULL) node->rightChild->isBlack_ = false;
-        if (node->leftChild != NULL) node->leftChild->isBlack_ = false;
-        return;
+        bound = node;
+        node = node->leftChild;
       }
     }
+    return AsNode(bound);
   }
-  void LeftRotate(Node *node) {
-    Node *temp = node->rightChild;
-    node->rightChild = temp->leftChild;
-    if (node->rightChild != NULL) {
-      node->rightChild->parent = node;
-      node->rightChild->isLeftChild_ = false;
-    }
-    FixChild(node, temp);
-    temp->leftChild = node;
-    node->isLeftChild_ = true;
-    node->parent = temp;
-  }
-
-  void RightRotate(Node *node) {
-    Node *temp = node->leftChild;
-    node->leftChild = temp->rightChild;
-    if (node->leftChild != NULL) {
-      node->leftChild->isLeftChild_ = true;
-      node->leftChild->parent = node;
-    }
-    FixChild(node, temp);
-    temp->rightChild = node;
-    node->isLeftChild_ = false;
-    node->parent = temp;
+
+  // First node of the run of keys equivalent to key, or NULL.
+  template <typename Key>
+  Node *FindFirst(const Key &key) {
+    Node *bound = LowerBound(key);
+    if (bound != NULL && !compare_(key, bound->key_)) return bound;
+    return NULL;
   }
 
-  void FixChild(Node *node, Node *temp) {
-    if (node->parent == NULL) {  // we are root_
-      root_ = temp;
-      temp->parent = NULL;
-    } else {
-      temp->parent = node->parent;
-      if (node->isLeftChild_) {
-        temp->isLeftChild_ = true;
-        temp->parent->leftChild = temp;
+  // First node whose key compares greater than key, or NULL.
+  template <typename Key>
+  Node *UpperBound(const Key &key) {
+    s21::RbHook *node = root_;
+    s21::RbHook *bound = NULL;
+    while (node != NULL) {
+      if (compare_(key, AsNode(node)->key_)) {
+        bound = node;
+        node = node->leftChild;
       } else {
-        temp->isLeftChild_ = false;
-        temp->parent->rightChild = temp;
+        node = node->rightChild;
       }
     }
+    return AsNode(bound);
   }
 
-  void LeftRightRotate(Node *node) {
-    LeftRotate(node->leftChild);
-    RightRotate(node);
+  // Returns the node holding key and whether it was just added.
+  std::pair<Node *, bool> AddNode(Node *other) {
+    return AddNode(other->key_, other->value_);
   }
 
-  void RightLeftRotate(Node *node) {
-    RightRotate(node->rightChild);
-    LeftRotate(node);
-  }
-
-  size_t GetSize() { return size_; };
-
-  Node *MaxInTree() { return root_->MinFromHere(); }
-
-  Node *MinInTree() { return root_->MinFromHere(); }
-
-  int Height() {
-    if (root_ == NULL) return 0;
-    return Height(root_) - 1;
-  }
-
-  int Height(Node *node) {
-    if (node == NULL) return 0;
-    int leftHeight = 0, rightHeight = 0;
-    leftHeight = Height(node->leftChild) + 1;
-    rightHeight = Height(node->rightChild) + 1;
-    if (leftHeight > rightHeight) return leftHeight;
-    return rightHeight;
-  }
+  std::pair<Node *, bool> AddNode(const K &key, const V &value) {
+    s21::RbHook *parent;
+    bool left;
+    Node *found = Locate(key, parent, left);
+    if (found != NULL) return {found, false};
+    Node *node = new Node(key, value);
+    s21::RbTree::Link(root_, parent, left, node);
+    size_ += 1;
+    return {node, true};
+  };
 
-  int CountBlack() {
-    if (root_ == NULL) return 1;
-    return CountBlack(root_) - 1;
+  /* Multi-key variants: equivalent keys may repeat and stay in the order
+     they were added, each new one going after the last of its run. */
+  Node *AddNodeMulti(const K &key, const V &value) {
+    Node *node = new Node(key, value);
+    LinkMulti(node);
+    return node;
   }
 
-  int CountBlack(Node *node) {
-    if (node == NULL) return 1;
-    int rightSideBlacks = CountBlack(node->rightChild);
-    int leftSideBlacks = CountBlack(node->leftChild);
-    if (rightSideBlacks != leftSideBlacks) {
-      return -1;
+  // Removes the whole run of keys equivalent to key and returns its length.
+  // The tree is split around the run and joined back without it, so this
+  // costs O(log n) plus the freeing, not a rebalancing erase per node.
+  template <typename Key>
+  size_t DeleteAll(const Key &key) {
+    if (FindNode(key) == NULL) return 0;
+    auto before = [this, &key](const Node *node) {
+      return compare_(node->key_, key);
     };
-    if (node->isBlack_) leftSideBlacks++;
-    return leftSideBlacks;
-  }
-
-  Node *FindNode(K key_) {
-    Node *result = NULL;
-    if (root_ != NULL) {
-      if (root_->key_ == key_) return root_;
-      result = FindNode(root_, key_);
-    }
-    return result;
+    auto within = [this, &key](const Node *node) {
+      return !compare_(key, node->key_);
+    };
+    auto below = Partition(root_, before);
+    auto run = Partition(below.second, within);
+    size_t removed = Count(run.first);
+    Destroy(run.first);
+    root_ = s21::RbTree::JoinTwo(below.first, run.second);
+    size_ -= removed;
+    return removed;
   }
 
-  Node *FindNode(Node *node, K key_) {
-    Node *result = NULL;
-    if (node != NULL) {
-      if (node->key_ == key_) return node;
-      if (key_ < node->key_) {
-        result = FindNode(node->leftChild, key_);
-      } else {
-        result = FindNode(node->rightChild, key_);
-      }
-    }
-    return result;
+  template <typename Key>
+  void DeleteNode(const Key &key) {
+    Node *removeThis = FindNode(key);
+    if (!removeThis) return;
+    s21::RbTree::Erase(root_, removeThis);
+    size_ -= 1;
+    delete removeThis;
   }
 
   // additional print
   void PrintTree(const std::string &prefix, const Node *node) {
     if (node != NULL) {
+      bool isLeftChild = node->parent && node->parent->leftChild == node;
       std::cout << prefix;
-      std::cout << (node->isLeftChild_ ? "├──" : "└──");
-      std::cout << node->key_ << (node->isBlack_ ? " (B)" : " (R)")
+      std::cout << (isLeftChild ? "├──" : "└──");
+      std::cout << node->key_ << (node->isBlack ? " (B)" : " (R)")
                 << std::endl;
-      PrintTree(prefix + (node->isLeftChild_ ? "│   " : "    "),
-                node->leftChild);
-      PrintTree(prefix + (node->isLeftChild_ ? "│   " : "    "),
-                node->rightChild);
+      PrintTree(prefix + (isLeftChild ? "│   " : "    "),
+                AsNode(node->leftChild));
+      PrintTree(prefix + (isLeftChild ? "│   " : "    "),
+                AsNode(node->rightChild));
     }
   }
 
-  void PrintTree() { PrintTree("", root_); }
+  void PrintTree() { PrintTree("", AsNode(root_)); }
 
   template <typename T>
   class RbIterator {
    public:
     typedef std::bidirectional_iterator_tag iterator_category;
     typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
     typedef T *pointer;
     typedef T &reference;
 
-    RbIterator() : ptr_(nullptr){};
+    RbIterator() : ptr_(nullptr), tree_(nullptr){};
 
-    RbIterator(T *ptr) : ptr_(ptr){};
+    RbIterator(T *ptr, const RedBlackTree *tree) : ptr_(ptr), tree_(tree){};
 
     RbIterator &operator++() {
       ptr_ = ptr_->Next();
       return *this;
     }
 
+    // --end() is the largest element
     RbIterator &operator--() {
-      ptr_ = ptr_->Previous();
+      ptr_ = ptr_ ? ptr_->Previous() : tree_->Last();
       return *this;
     }
 
@@ -507,47 +305,473 @@ class RedBlackTree {
 
    private:
     T *ptr_;
+    const RedBlackTree *tree_;
   };
 
   typedef RbIterator<Node> iterator;
   typedef RbIterator<const Node> const_iterator;
 
-  iterator begin() { return iterator(root_->MinFromHere()); }
+  iterator begin() { return iterator(root_ ? MinInTree() : NULL, this); }
 
-  iterator end() { return ++iterator(root_->MaxFromHere()); }
+  iterator end() { return iterator(NULL, this); }
 
-  const_iterator begin() const { return iterator(root_->MinFromHere()); }
+  const_iterator begin() const {
+    return const_iterator(root_ ? AsNode(root_)->MinFromHere() : NULL, this);
+  }
 
-  const_iterator end() const { return ++iterator(root_->MaxFromHere()); }
+  const_iterator end() const { return const_iterator(NULL, this); }
 
-  // additional print
+  // The largest node, or NULL when empty.
+  Node *Last() const {
+    return root_ ? AsNode(s21::RbTree::MaxFromHere(root_)) : NULL;
+  }
+
+  size_t GetSize() { return size_; };
+
+  Compare KeyComp() const { return compare_; }
+
+  // Frees every node in one linear pass, with no rebalancing or recursion.
+  void Clear() noexcept {
+    Destroy(root_);
+    root_ = NULL;
+    size_ = 0;
+  }
+
+  Node *MaxInTree() { return AsNode(root_)->MaxFromHere(); }
+
+  Node *MinInTree() { return AsNode(root_)->MinFromHere(); }
+
+  /* Replaces the contents with n entries that next() yields as
+     std::pair<K, V> in strictly ascending key order. The tree is built
+     perfectly balanced in O(n): all levels but the deepest are full, so
+     colouring just that level red keeps the black height equal. */
+  template <typename Source>
+  void BuildSorted(size_t n, Source next) {
+    int deepest = 0;
+    for (size_t m = n; m > 1; m >>= 1) ++deepest;
+    const K *previous = NULL;
+    RedBlackTree temp(compare_);
+    temp.root_ = temp.BuildSorted(n, 0, deepest, next, previous);
+    temp.size_ = n;
+    *this = std::move(temp);
+  }
+
+  /* Set algebra by join and split (Blelloch, Ferizovic and Sun). Each
+     operation recurses over the other tree, splitting this one at its
+     root's key and joining the two recursive results back, which costs
+     O(m log(n / m + 1)) for trees of m <= n nodes. The two recursive calls
+     touch disjoint nodes, so fork(depth, left, right) may run them
+     concurrently; SerialFork just calls them in turn. */
+  struct SerialFork {
+    template <typename Left, typename Right>
+    void operator()(int, const s21::RbHook *, Left left, Right right) {
+      left();
+      right();
+    }
+  };
+
+  // Adds the keys of other missing here, copying just those nodes.
+  template <typename Fork = SerialFork>
+  void Unite(const RedBlackTree &other, Fork fork = Fork()) {
+    if (&other == this) return;
+    size_t added = 0;
+    root_ = UniteCopy(root_, other.root_, added, 0, fork);
+    size_ += added;
+  }
+
+  // Moves the nodes of other whose key is missing here; the rest stay in
+  // other, which is rebuilt from them by the same joins.
+  template <typename Fork = SerialFork>
+  void Merge(RedBlackTree &other, Fork fork = Fork()) {
+    if (&other == this) return;
+    size_t kept = 0;
+    s21::RbHook *rest = NULL;
+    root_ = UniteMove(root_, other.root_, rest, kept, 0, fork);
+    size_ += other.size_ - kept;
+    other.root_ = rest;
+    other.size_ = kept;
+  }
+
+  // Keeps only the keys also present in other.
+  template <typename Fork = SerialFork>
+  void Intersect(const RedBlackTree &other, Fork fork = Fork()) {
+    if (&other == this) return;
+    size_t removed = 0;
+    root_ = IntersectWith(root_, other.root_, removed, 0, fork);
+    size_ -= removed;
+  }
+
+  // Removes the keys present in other.
+  template <typename Fork = SerialFork>
+  void Subtract(const RedBlackTree &other, Fork fork = Fork()) {
+    if (&other == this) {
+      Clear();
+      return;
+    }
+    size_t removed = 0;
+    root_ = SubtractWith(root_, other.root_, removed, 0, fork);
+    size_ -= removed;
+  }
+
+  void swap(RedBlackTree &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    std::swap(compare_, other.compare_);
+  }
+
+  /* Owns a node taken out of a tree, so it can move to another tree of the
+     same type without being copied or reallocated. An empty handle owns
+     nothing; a non-empty one frees its node unless it is inserted. */
+  class NodeHandle {
+   public:
+    NodeHandle() noexcept : node_(NULL) {}
+    NodeHandle(NodeHandle &&other) noexcept : node_(other.node_) {
+      other.node_ = NULL;
+    }
+    NodeHandle &operator=(NodeHandle &&other) noexcept {
+      if (this != &other) {
+        delete node_;
+        node_ = other.node_;
+        other.node_ = NULL;
+      }
+      return *this;
+    }
+    ~NodeHandle() { delete node_; }
+
+    bool empty() const noexcept { return node_ == NULL; }
+    explicit operator bool() const noexcept { return node_ != NULL; }
+
+    const K &key() const { return node_->key_; }
+    V &mapped() const { return node_->value_; }
+    // what a set calls its element
+    const K &value() const { return node_->key_; }
+
+    void swap(NodeHandle &other) noexcept { std::swap(node_, other.node_); }
+
+   private:
+    friend class RedBlackTree;
+    explicit NodeHandle(Node *node) noexcept : node_(node) {}
+
+    Node *Release() noexcept {
+      Node *node = node_;
+      node_ = NULL;
+      return node;
+    }
+
+    Node *node_;
+  };
+
+  // Unlinks node and hands it to the caller; a null node gives an empty
+  // handle.
+  NodeHandle Extract(Node *node) {
+    if (node == NULL) return NodeHandle();
+    s21::RbTree::Erase(root_, node);
+    size_ -= 1;
+    return NodeHandle(node);
+  }
+
+  // Links the node of handle in and empties it, returning the node. If the
+  // key is already present, the handle keeps its node and the node holding
+  // that key is returned instead. An empty handle gives NULL.
+  Node *Insert(NodeHandle &handle) {
+    if (handle.empty()) return NULL;
+    s21::RbHook *parent;
+    bool left;
+    Node *found = Locate(handle.node_->key_, parent, left);
+    if (found != NULL) return found;
+    Node *inserted = handle.Release();
+    s21::RbTree::Link(root_, parent, left, inserted);
+    size_ += 1;
+    return inserted;
+  }
+
+  // Like Insert, but never refuses the node.
+  Node *InsertMulti(NodeHandle &handle) {
+    if (handle.empty()) return NULL;
+    Node *node = handle.Release();
+    LinkMulti(node);
+    return node;
+  }
 
  private:
-  void AddNode(Node *parent, Node *newNode) {
-    if (parent->key_ < newNode->key_) {
-      if (parent->rightChild == NULL) {
-        parent->rightChild = newNode;
-        newNode->parent = parent;
-        newNode->isLeftChild_ = false;
-        return;
+  static Node *AsNode(s21::RbHook *hook) { return static_cast<Node *>(hook); }
+  static const Node *AsNode(const s21::RbHook *hook) {
+    return static_cast<const Node *>(hook);
+  }
+
+  // Finds where key would be linked (below parent, on the left or right)
+  // and returns the node already holding key, if any. One comparison per
+  // level: a three-way one where the key type offers it, otherwise "less
+  // than" as in LowerBound plus one more against the bound at the end.
+  template <typename Key>
+  Node *Locate(const Key &key, s21::RbHook *&parent, bool &left) {
+    parent = NULL;
+    left = true;
+    s21::RbHook *bound = NULL;
+    for (s21::RbHook *node = root_; node != NULL;) {
+      parent = node;
+      if constexpr (s21::detail::kThreeWay<Compare, Key, K>) {
+        int order = s21::detail::ThreeWay(key, AsNode(node)->key_);
+        if (order == 0) return AsNode(node);
+        left = order < 0;
       } else {
-        AddNode(parent->rightChild, newNode);
-        CheckColor(newNode);
+        left = !compare_(AsNode(node)->key_, key);
+        if (left) bound = node;
       }
-    } else {
-      if (parent->leftChild == NULL) {
-        parent->leftChild = newNode;
-        newNode->parent = parent;
-        newNode->isLeftChild_ = true;
-        return;
+      node = left ? node->leftChild : node->rightChild;
+    }
+    if (bound != NULL && !compare_(key, AsNode(bound)->key_)) {
+      return AsNode(bound);
+    }
+    return NULL;
+  }
+
+  static bool IsRed(const s21::RbHook *node) {
+    return node != NULL && !node->isBlack;
+  }
+
+  // Frees a subtree without recursing: a node with a left child is rotated
+  // right until it has none, then freed before moving on to its right.
+  // Each rotation moves one node off the left spine for good, so the whole
+  // pass is O(n).
+  static void Destroy(s21::RbHook *node) noexcept {
+    while (node != NULL) {
+      s21::RbHook *left = node->leftChild;
+      if (left != NULL) {
+        node->leftChild = left->rightChild;
+        left->rightChild = node;
+        node = left;
       } else {
-        AddNode(parent->leftChild, newNode);
-        CheckColor(newNode);
+        s21::RbHook *right = node->rightChild;
+        delete AsNode(node);
+        node = right;
       }
     }
+  }
+
+  static size_t Count(const s21::RbHook *node) {
+    return node ? Count(node->leftChild) + 1 + Count(node->rightChild) : 0;
+  }
+
+  // Cuts the tree under node in two: the nodes goes_left accepts, which
+  // must be a prefix of the key order, and the rest.
+  template <typename Predicate>
+  static std::pair<s21::RbHook *, s21::RbHook *> Partition(
+      s21::RbHook *node, Predicate &goes_left) {
+    if (node == NULL) return {NULL, NULL};
+    s21::RbHook *left = node->leftChild;
+    s21::RbHook *right = node->rightChild;
+    if (goes_left(AsNode(node))) {
+      auto parts = Partition(right, goes_left);
+      parts.first = s21::RbTree::Join(left, node, parts.first);
+      return parts;
+    }
+    auto parts = Partition(left, goes_left);
+    parts.second = s21::RbTree::Join(parts.second, node, right);
+    return parts;
+  }
+
+  void LinkMulti(Node *node) {
+    s21::RbHook *parent = NULL;
+    bool left = true;
+    for (s21::RbHook *at = root_; at != NULL;) {
+      parent = at;
+      left = compare_(node->key_, AsNode(at)->key_);
+      at = left ? at->leftChild : at->rightChild;
+    }
+    s21::RbTree::Link(root_, parent, left, node);
+    size_ += 1;
+  }
+
+  struct Split {
+    s21::RbHook *left;
+    Node *match;
+    s21::RbHook *right;
   };
+
+  // Cuts the tree under node into the keys below key, the node holding
+  // key (if any) and the keys above it.
+  Split SplitAt(s21::RbHook *node, const K &key) const {
+    if (node == NULL) return {NULL, NULL, NULL};
+    s21::RbHook *left = node->leftChild;
+    s21::RbHook *right = node->rightChild;
+    if (compare_(key, AsNode(node)->key_)) {
+      Split split = SplitAt(left, key);
+      split.right = s21::RbTree::Join(split.right, node, right);
+      return split;
+    }
+    if (compare_(AsNode(node)->key_, key)) {
+      Split split = SplitAt(right, key);
+      split.left = s21::RbTree::Join(left, node, split.left);
+      return split;
+    }
+    node->leftChild = node->rightChild = NULL;
+    return {s21::RbTree::Detach(left), AsNode(node),
+            s21::RbTree::Detach(right)};
+  }
+
+  static s21::RbHook *CopySubtree(const s21::RbHook *node) {
+    if (node == NULL) return NULL;
+    Node *copy = new Node(*AsNode(node));
+    copy->leftChild = CopySubtree(node->leftChild);
+    copy->rightChild = CopySubtree(node->rightChild);
+    if (copy->leftChild) copy->leftChild->parent = copy;
+    if (copy->rightChild) copy->rightChild->parent = copy;
+    return copy;
+  }
+
+  template <typename Fork>
+  s21::RbHook *UniteCopy(s21::RbHook *mine, const s21::RbHook *theirs,
+                         size_t &added, int depth, Fork &fork) const {
+    if (theirs == NULL) return s21::RbTree::Detach(mine);
+    if (mine == NULL) {
+      added += Count(theirs);
+      return s21::RbTree::Detach(CopySubtree(theirs));
+    }
+    const Node *pivot = AsNode(theirs);
+    Split split = SplitAt(mine, pivot->key_);
+    s21::RbHook *left = NULL, *right = NULL;
+    size_t left_added = 0, right_added = 0;
+    fork(
+        depth, theirs,
+        [&] {
+          left = UniteCopy(split.left, theirs->leftChild, left_added,
+                           depth + 1, fork);
+        },
+        [&] {
+          right = UniteCopy(split.right, theirs->rightChild, right_added,
+                            depth + 1, fork);
+        });
+    added += left_added + right_added;
+    Node *middle = split.match;
+    if (middle == NULL) {
+      middle = new Node(pivot->key_, pivot->value_);
+      ++added;
+    }
+    return s21::RbTree::Join(left, middle, right);
+  }
+
+  // Like UniteCopy, but relinks the nodes of theirs; those whose key is
+  // already in mine are joined into rest instead, kept counting them.
+  template <typename Fork>
+  s21::RbHook *UniteMove(s21::RbHook *mine, s21::RbHook *theirs,
+                         s21::RbHook *&rest, size_t &kept, int depth,
+                         Fork &fork) const {
+    if (theirs == NULL) return s21::RbTree::Detach(mine);
+    if (mine == NULL) return s21::RbTree::Detach(theirs);
+    s21::RbHook *their_left = theirs->leftChild;
+    s21::RbHook *their_right = theirs->rightChild;
+    Split split = SplitAt(mine, AsNode(theirs)->key_);
+    s21::RbHook *left = NULL, *right = NULL;
+    s21::RbHook *left_rest = NULL, *right_rest = NULL;
+    size_t left_kept = 0, right_kept = 0;
+    fork(
+        depth, theirs,
+        [&] {
+          left = UniteMove(split.left, their_left, left_rest, left_kept,
+                           depth + 1, fork);
+        },
+        [&] {
+          right = UniteMove(split.right, their_right, right_rest, right_kept,
+                            depth + 1, fork);
+        });
+    kept += left_kept + right_kept;
+    if (split.match == NULL) {
+      rest = s21::RbTree::JoinTwo(left_rest, right_rest);
+      return s21::RbTree::Join(left, theirs, right);
+    }
+    rest = s21::RbTree::Join(left_rest, theirs, right_rest);
+    ++kept;
+    return s21::RbTree::Join(left, split.match, right);
+  }
+
+  template <typename Fork>
+  s21::RbHook *IntersectWith(s21::RbHook *mine, const s21::RbHook *theirs,
+                             size_t &removed, int depth, Fork &fork) const {
+    if (mine == NULL) return NULL;
+    if (theirs == NULL) {
+      removed += Count(mine);
+      Destroy(mine);
+      return NULL;
+    }
+    Split split = SplitAt(mine, AsNode(theirs)->key_);
+    s21::RbHook *left = NULL, *right = NULL;
+    size_t left_removed = 0, right_removed = 0;
+    fork(
+        depth, theirs,
+        [&] {
+          left = IntersectWith(split.left, theirs->leftChild, left_removed,
+                               depth + 1, fork);
+        },
+        [&] {
+          right = IntersectWith(split.right, theirs->rightChild,
+                                right_removed, depth + 1, fork);
+        });
+    removed += left_removed + right_removed;
+    if (split.match != NULL) {
+      return s21::RbTree::Join(left, split.match, right);
+    }
+    return s21::RbTree::JoinTwo(left, right);
+  }
+
+  template <typename Fork>
+  s21::RbHook *SubtractWith(s21::RbHook *mine, const s21::RbHook *theirs,
+                            size_t &removed, int depth, Fork &fork) const {
+    if (mine == NULL || theirs == NULL) return s21::RbTree::Detach(mine);
+    Split split = SplitAt(mine, AsNode(theirs)->key_);
+    s21::RbHook *left = NULL, *right = NULL;
+    size_t left_removed = 0, right_removed = 0;
+    fork(
+        depth, theirs,
+        [&] {
+          left = SubtractWith(split.left, theirs->leftChild, left_removed,
+                              depth + 1, fork);
+        },
+        [&] {
+          right = SubtractWith(split.right, theirs->rightChild,
+                               right_removed, depth + 1, fork);
+        });
+    removed += left_removed + right_removed;
+    if (split.match != NULL) {
+      delete split.match;
+      ++removed;
+    }
+    return s21::RbTree::JoinTwo(left, right);
+  }
+
+  template <typename Source>
+  Node *BuildSorted(size_t n, int depth, int red_depth, Source &next,
+                    const K *&previous) {
+    if (n == 0) return NULL;
+    Node *left = BuildSorted(n / 2, depth + 1, red_depth, next, previous);
+    Node *node = NULL;
+    try {
+      std::pair<K, V> entry = next();
+      if (previous && !compare_(*previous, entry.first))
+        throw std::invalid_argument("keys are not strictly ascending");
+      node = new Node(entry.first, entry.second);
+    } catch (...) {
+      Destroy(left);
+      throw;
+    }
+    node->isBlack = depth == 0 || depth != red_depth;
+    node->leftChild = left;
+    if (left) left->parent = node;
+    previous = &node->key_;
+    try {
+      node->rightChild =
+          BuildSorted(n - n / 2 - 1, depth + 1, red_depth, next, previous);
+    } catch (...) {
+      Destroy(node);
+      throw;
+    }
+    if (node->rightChild) node->rightChild->parent = node;
+    return node;
+  }
+
   size_t size_;
-  Node *root_;
+  s21::RbHook *root_;
+  Compare compare_;
 };
 
 #endif  // S21_CONTAINERS_SRC_TREES_S21_RED_BLACK_TREE_H_
@@ -0,0 +1,59 @@
+#ifndef S21_CONTAINERS_SRC_TREES_S21_TREE_COMPARE_H_
+#define S21_CONTAINERS_SRC_TREES_S21_TREE_COMPARE_H_
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace s21 {
+
+namespace detail {
+
+template <typename Compare>
+struct IsStdLess : std::false_type {};
+
+template <typename T>
+struct IsStdLess<std::less<T>> : std::true_type {};
+
+// The string type behind T when T is a std::basic_string or
+// std::basic_string_view, whose operator< is defined as compare() < 0;
+// void for anything else.
+template <typename T>
+struct StringView {
+  using type = void;
+};
+
+template <typename C, typename Tr, typename Al>
+struct StringView<std::basic_string<C, Tr, Al>> {
+  using type = std::basic_string_view<C, Tr>;
+};
+
+template <typename C, typename Tr>
+struct StringView<std::basic_string_view<C, Tr>> {
+  using type = std::basic_string_view<C, Tr>;
+};
+
+// True when Compare is plain std::less and A and B are standard strings of
+// one character type, so a.compare(b) is a three-way comparison agreeing
+// with it. C++17 has no operator<=>; any other comparator or key type is
+// only trusted to answer "less than", whatever compare() it may have.
+template <typename Compare, typename A, typename B>
+inline constexpr bool kThreeWay =
+    IsStdLess<Compare>::value &&
+    !std::is_void_v<typename StringView<A>::type> &&
+    std::is_same_v<typename StringView<A>::type,
+                   typename StringView<B>::type>;
+
+// Negative, zero or positive as a orders before, together with or after b.
+// Only meaningful when kThreeWay holds.
+template <typename A, typename B>
+int ThreeWay(const A& a, const B& b) {
+  return a.compare(b);
+}
+
+}  // namespace detail
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_TREES_S21_TREE_COMPARE_H_